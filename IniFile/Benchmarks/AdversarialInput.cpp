@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+namespace
+{
+  enum class Pattern
+  {
+    LongValue,   // Key=vvvv...
+    LongKey,     // kkkk... with no '='
+    ManyEquals   // Key=a=a=a=...
+  };
+
+  std::string MakeAdversarialText(Pattern Kind, std::size_t LineLength, std::size_t TotalSize)
+  {
+    std::string Line;
+
+    switch (Kind)
+    {
+      case Pattern::LongValue:
+        Line = "Key=" + std::string(LineLength, 'v');
+        break;
+      case Pattern::LongKey:
+        Line = std::string(LineLength, 'k');
+        break;
+      case Pattern::ManyEquals:
+        Line = "Key=";
+        while (Line.size() < LineLength)
+          Line += "a=";
+        break;
+    }
+
+    std::string Text = "[Section]\n";
+    while (Text.size() < TotalSize)
+      Text += Line + "\n";
+
+    return Text;
+  }
+
+  const char *PatternName(Pattern Kind)
+  {
+    switch (Kind)
+    {
+      case Pattern::LongValue:
+        return "long value";
+      case Pattern::LongKey:
+        return "long key";
+      default:
+        return "many '='";
+    }
+  }
+
+  double TimeParse(const std::string &Text, IniParseMode Mode)
+  {
+    const std::string Path = Bench::WriteTempFile("IniFileBench_Adversarial.ini", Text);
+    const double Seconds = Bench::BestOf(3, [&]() { IniFile Ini(Path, Mode); });
+    std::filesystem::remove(Path);
+    return Seconds;
+  }
+}  // namespace
+
+TEST_CASE("Scanner parse time stays proportional to file size on adversarial input", "[.][benchmark][scanner][adversarial]")
+{
+  for (Pattern Kind : {Pattern::LongValue, Pattern::LongKey, Pattern::ManyEquals})
+  {
+    // A single 64 KB line grown into files of increasing size
+    for (std::size_t TotalSize : {std::size_t(1) << 20, std::size_t(1) << 22, std::size_t(1) << 24})
+    {
+      const std::string Text = MakeAdversarialText(Kind, 64 * 1024, TotalSize);
+      const double      Seconds = TimeParse(Text, IniParseMode::Scanner);
+
+      Bench::ReportThroughput(std::string("Scanner, ") + PatternName(Kind) + ", " + std::to_string(Text.size() >> 10) + " KB", Text.size(), Seconds);
+    }
+  }
+}
+
+TEST_CASE("Regex parse time grows with line length on adversarial input", "[.][benchmark][regex][adversarial]")
+{
+  // Kept small, a single 64 KB key line takes the regex parser well over a minute
+  for (std::size_t LineLength : {std::size_t(1) << 10, std::size_t(1) << 11, std::size_t(1) << 12})
+  {
+    const std::string Text = MakeAdversarialText(Pattern::LongKey, LineLength, LineLength);
+    const double      Regex = TimeParse(Text, IniParseMode::Regex);
+    const double      Scanner = TimeParse(Text, IniParseMode::Scanner);
+
+    Bench::ReportThroughput("Regex, long key, " + std::to_string(LineLength) + " byte line", Text.size(), Regex);
+    Bench::ReportThroughput("Scanner, long key, " + std::to_string(LineLength) + " byte line", Text.size(), Scanner);
+  }
+}
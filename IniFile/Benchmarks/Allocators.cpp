@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+TEST_CASE("Allocations and parse time with the default resource and a monotonic arena", "[.][benchmark][allocator][pmr]")
+{
+  const std::string Text = Bench::MakeIniText(20000, 12);
+
+  std::size_t DefaultAllocations = 0;
+  std::size_t ArenaAllocations = 0;
+
+  const double DefaultTime = Bench::BestOf(5, [&]() {
+    AllocationScope Scope;
+    {
+      IniFile Ini;
+      Ini.ParseBuffer(Text);
+    }
+    DefaultAllocations = Scope.GetCount();
+  });
+
+  const double ArenaTime = Bench::BestOf(5, [&]() {
+    AllocationScope Scope;
+    {
+      std::pmr::monotonic_buffer_resource Arena(Text.size() * 4);
+
+      IniFile Ini(&Arena);
+      Ini.ParseBuffer(Text);
+    }
+    ArenaAllocations = Scope.GetCount();
+  });
+
+  Bench::ReportThroughput("Default resource, parse + destroy", Text.size(), DefaultTime);
+  Bench::ReportThroughput("Monotonic arena, parse + release", Text.size(), ArenaTime);
+  std::printf("%-48s %10zu\n", "Heap allocations per parse, default resource", DefaultAllocations);
+  std::printf("%-48s %10zu\n", "Heap allocations per parse, monotonic arena", ArenaAllocations);
+
+  REQUIRE(ArenaAllocations < DefaultAllocations);
+}
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Helpers shared by the benchmarks in this directory
+//
+// Benchmarks are hidden test cases tagged [.][benchmark], run them with
+//   IniFile.exe "[benchmark]"
+
+namespace Bench
+{
+  // Generates an ini file with NumSections sections of EntriesPerSection
+  // entries each, mixing comments, single values and appended list values
+  inline std::string MakeIniText(std::size_t NumSections, std::size_t EntriesPerSection)
+  {
+    std::string Text;
+    Text.reserve(NumSections * EntriesPerSection * 40);
+
+    for (std::size_t s = 0; s < NumSections; ++s)
+    {
+      Text += "# Generated section " + std::to_string(s) + "\n";
+      Text += "[Section" + std::to_string(s) + "] ;trailing comment\n";
+
+      for (std::size_t e = 0; e < EntriesPerSection; ++e)
+      {
+        const std::string Key = "Key" + std::to_string(e);
+
+        if (e % 4 == 3)
+          Text += "+Key" + std::to_string(e - 1) + "=(List,\"Value\"," + std::to_string(e) + ")\n";
+        else
+          Text += Key + "=\"SomeValue_" + std::to_string(s * EntriesPerSection + e) + "\" #comment\n";
+      }
+
+      Text += "\n";
+    }
+
+    return Text;
+  }
+
+  inline std::string WriteTempFile(const std::string &Name, const std::string &Contents)
+  {
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / Name;
+
+    std::ofstream Out(Path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    Out.write(Contents.data(), static_cast<std::streamsize>(Contents.size()));
+    return Path.string();
+  }
+
+  // Returns the best time in seconds out of Iterations runs of Fn
+  template<class Fn>
+  double BestOf(int Iterations, Fn &&ToTime)
+  {
+    double Best = 0.0;
+
+    for (int i = 0; i < Iterations; ++i)
+    {
+      const auto Start = std::chrono::steady_clock::now();
+      ToTime();
+      const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+      if (i == 0 || Elapsed.count() < Best)
+        Best = Elapsed.count();
+    }
+
+    return Best;
+  }
+
+  inline void ReportThroughput(const std::string &Label, std::size_t Bytes, double Seconds)
+  {
+    const double MegaBytes = static_cast<double>(Bytes) / (1024.0 * 1024.0);
+
+    std::printf("%-48s %10.3f ms %10.1f MB/s\n", Label.c_str(), Seconds * 1000.0, Seconds > 0.0 ? MegaBytes / Seconds : 0.0);
+  }
+
+  inline void ReportLatency(const std::string &Label, std::size_t Operations, double Seconds)
+  {
+    std::printf("%-48s %10.2f ns/op\n", Label.c_str(), Operations ? (Seconds * 1e9) / static_cast<double>(Operations) : 0.0);
+  }
+}  // namespace Bench
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+#include <filesystem>
+
+TEST_CASE("Loading from the binary cache against parsing the file", "[.][benchmark][cache]")
+{
+  for (std::size_t NumSections : {100, 10000})
+  {
+    const std::string Text = Bench::MakeIniText(NumSections, 20);
+    const std::string FileName = Bench::WriteTempFile("IniFileBench_Cache.ini", Text);
+    const std::string CacheFileName = FileName + ".cache";
+
+    IniFile(FileName).WriteCache(FileName, CacheFileName);
+
+    const double ParseTime = Bench::BestOf(5, [&]() {
+      IniFile Ini(FileName);
+      REQUIRE(Ini.HasSection("Section0"));
+    });
+
+    const double CacheTime = Bench::BestOf(5, [&]() {
+      IniFile Ini;
+      REQUIRE(Ini.ReadCache(FileName, CacheFileName));
+      REQUIRE(Ini.HasSection("Section0"));
+    });
+
+    const std::string Size = std::to_string(NumSections) + " sections";
+    Bench::ReportThroughput("ReadFile, " + Size, Text.size(), ParseTime);
+    Bench::ReportThroughput("ReadCache, " + Size, Text.size(), CacheTime);
+    std::printf("%-48s %10zu bytes\n", ("Cache file, " + Size).c_str(), static_cast<std::size_t>(std::filesystem::file_size(CacheFileName)));
+
+    std::filesystem::remove(FileName);
+    std::filesystem::remove(CacheFileName);
+  }
+}
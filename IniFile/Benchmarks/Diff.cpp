@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniDiff.h>
+
+#include <filesystem>
+
+namespace
+{
+  // What IniDiff saves: every value of every entry compared
+  std::size_t CountChangedEntries(IniFile &Old, IniFile &New)
+  {
+    std::size_t Changed = 0;
+
+    for (auto SectionIt = New.cbegin(); SectionIt != New.cend(); ++SectionIt)
+    {
+      auto OldSection = Old.TryGetSection(SectionIt->first);
+      for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+      {
+        auto OldEntry = OldSection->get().TryGetEntry(EntryIt->first);
+        Changed += (!OldEntry || OldEntry->get().GetValues() != EntryIt->second.GetValues());
+      }
+    }
+
+    return Changed;
+  }
+}  // namespace
+
+TEST_CASE("IniDiff of 100k entry files with one change", "[.][benchmark][diff]")
+{
+  // 13 lines per section, every fourth adds a value to the entry before it
+  const std::string OldText = Bench::MakeIniText(10000, 13);
+  std::string       NewText = OldText;
+  NewText.replace(NewText.find("\"SomeValue_65000\""), 17, "\"Changed_65000\"");
+
+  const std::string OldFileName = Bench::WriteTempFile("IniFileBench_DiffOld.ini", OldText);
+  const std::string NewFileName = Bench::WriteTempFile("IniFileBench_DiffNew.ini", NewText);
+
+  // ReadFile hashes sections as it scans
+  IniFile Old(OldFileName);
+  IniFile New(NewFileName);
+
+  // ParseBuffer does not, and the result is not clean, so it is hashed again
+  // on every diff
+  IniFile Parsed;
+  Parsed.ParseBuffer(NewText);
+
+  std::size_t NumEntries = 0;
+  for (auto it = Old.cbegin(); it != Old.cend(); ++it)
+    NumEntries += it->second.GetNumEntries();
+
+  std::size_t Changes = 0;
+
+  const double ReadFileTime = Bench::BestOf(5, [&]() {
+    Changes += IniDiff(Old, New).GetNumEntryChanges();
+  });
+
+  const double ParsedTime = Bench::BestOf(5, [&]() {
+    Changes += IniDiff(Old, Parsed).GetNumEntryChanges();
+  });
+
+  const double EntryByEntryTime = Bench::BestOf(5, [&]() {
+    Changes += CountChangedEntries(Old, New);
+  });
+
+  const std::string Size = std::to_string(NumEntries) + " entries";
+  Bench::ReportThroughput("IniDiff, both read by ReadFile, " + Size, NewText.size(), ReadFileTime);
+  Bench::ReportThroughput("IniDiff, new one hashed by the diff, " + Size, NewText.size(), ParsedTime);
+  Bench::ReportThroughput("Entry by entry comparison, " + Size, NewText.size(), EntryByEntryTime);
+
+  REQUIRE(NumEntries == 100000);
+  REQUIRE(Changes == 15);
+
+  std::filesystem::remove(OldFileName);
+  std::filesystem::remove(NewFileName);
+}
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniDocument.h>
+#include <IniFile/IniFile.h>
+
+TEST_CASE("Loading a large file as an IniDocument against an IniFile", "[.][benchmark][document]")
+{
+  const std::string Text = Bench::MakeIniText(200000, 12);
+  const std::string Path = Bench::WriteTempFile("IniFileBench_Document.ini", Text);
+
+  std::size_t DocumentSections = 0;
+  std::size_t FileSections = 0;
+
+  const double DocumentTime = Bench::BestOf(3, [&]() {
+    IniDocument Document;
+    Document.ReadFile(Path);
+    DocumentSections = Document.GetNumSections();
+  });
+
+  const double FileTime = Bench::BestOf(3, [&]() {
+    IniFile Ini(Path);
+    FileSections = static_cast<std::size_t>(std::distance(Ini.begin(), Ini.end()));
+  });
+
+  Bench::ReportThroughput("IniDocument::ReadFile", Text.size(), DocumentTime);
+  Bench::ReportThroughput("IniFile(FileName)", Text.size(), FileTime);
+
+  REQUIRE(DocumentSections == FileSections);
+  std::filesystem::remove(Path);
+}
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <vector>
+
+TEST_CASE("Memory per entry and value access latency of IniEntry", "[.][benchmark][entry]")
+{
+  constexpr std::size_t NumEntries = 100000;
+
+  std::printf("%-48s %10zu bytes\n", "sizeof(IniEntry)", sizeof(IniEntry));
+
+  // Short values stay in the strings' small buffers, so the counted bytes are
+  // the value list itself
+  for (std::size_t NumValues : {1, 2, 4})
+  {
+    CountingResource Counting;
+    {
+      std::vector<IniEntry> Entries;
+      Entries.reserve(NumEntries);
+
+      for (std::size_t i = 0; i < NumEntries; ++i)
+      {
+        Entries.emplace_back(std::string_view("Key"), &Counting);
+        for (std::size_t v = 0; v < NumValues; ++v)
+          Entries.back().AddValue("Value");
+      }
+    }
+
+    const std::string Label = "Heap bytes per entry, " + std::to_string(NumValues) + " value(s)";
+    std::printf("%-48s %10.1f bytes\n", Label.c_str(), static_cast<double>(Counting.GetBytesAllocated()) / NumEntries);
+  }
+
+  const std::string Text = Bench::MakeIniText(NumEntries / 12, 12);
+
+  CountingResource Counting;
+  IniFile          Ini(&Counting);
+  Ini.ParseBuffer(Text);
+
+  std::vector<std::pair<std::string, std::string>> Keys;
+  std::vector<const IniEntry *>                    Entries;
+  for (auto &SectionPair : Ini)
+  {
+    for (auto &EntryPair : SectionPair.second)
+    {
+      Keys.emplace_back(SectionPair.first, EntryPair.first);
+      Entries.push_back(&EntryPair.second);
+    }
+  }
+
+  std::printf("%-48s %10.1f bytes\n", "Heap bytes per entry, whole parse (cumulative)", static_cast<double>(Counting.GetBytesAllocated()) / Entries.size());
+  std::printf("%-48s %10.1f bytes\n", "Heap bytes per entry, whole parsed file (live)", static_cast<double>(Counting.GetLiveBytes()) / Entries.size());
+
+  std::size_t Checksum = 0;
+
+  const double LookupTime = Bench::BestOf(5, [&]() {
+    for (const auto &Key : Keys)
+      Checksum += Ini.TryGetSection(Key.first).value().get()[Key.second].GetValues().front().size();
+  });
+
+  const double ValueTime = Bench::BestOf(5, [&]() {
+    for (const IniEntry *Entry : Entries)
+    {
+      const auto &Values = Entry->GetValues();
+      for (std::size_t v = 0; v < Values.size(); ++v)
+        Checksum += Values[v].size();
+    }
+  });
+
+  Bench::ReportLatency("Section + entry lookup, first value", Keys.size(), LookupTime);
+  Bench::ReportLatency("Indexed walk over an entry's values", Entries.size(), ValueTime);
+
+  REQUIRE(Checksum > 0);
+}
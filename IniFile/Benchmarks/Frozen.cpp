@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/FrozenIni.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("FrozenIni lookup latency and memory against IniFile", "[.][benchmark][frozen]")
+{
+  constexpr std::size_t NumLookups = 1000000;
+
+  for (std::size_t NumSections : {1, 100, 2500})
+  {
+    constexpr std::size_t EntriesPerSection = 40;
+
+    CountingResource Counting;
+    IniFile          Ini(&Counting);
+    Ini.ParseBuffer(Bench::MakeIniText(NumSections, EntriesPerSection));
+
+    const FrozenIni Frozen = Ini.Freeze();
+
+    std::vector<std::pair<std::string, std::string>> Paths;
+    for (auto SectionIt = Ini.cbegin(); SectionIt != Ini.cend(); ++SectionIt)
+      for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+        Paths.emplace_back(SectionIt->first, EntryIt->first);
+
+    std::vector<IniKey> Keys;
+    for (const auto &Path : Paths)
+      Keys.emplace_back(Path.first, Path.second);
+
+    std::vector<std::size_t> Order(NumLookups);
+    std::mt19937             Random(42);
+    for (std::size_t &Index : Order)
+      Index = Random() % Paths.size();
+
+    std::size_t Found = 0;
+
+    const double IniTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Ini.TryGetSection(Paths[Index].first)->get().TryGetEntry(Paths[Index].second).has_value();
+    });
+
+    const double IniKeyTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Ini.TryGetEntry(Keys[Index]).has_value();
+    });
+
+    const double FrozenTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Frozen.TryGetEntry(Paths[Index].first, Paths[Index].second).has_value();
+    });
+
+    const double FrozenKeyTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Frozen.TryGetEntry(Keys[Index]).has_value();
+    });
+
+    const std::string Size = std::to_string(Paths.size()) + " keys";
+    Bench::ReportLatency("IniFile TryGetSection + TryGetEntry, " + Size, NumLookups, IniTime);
+    Bench::ReportLatency("IniFile TryGetEntry(IniKey), " + Size, NumLookups, IniKeyTime);
+    Bench::ReportLatency("FrozenIni TryGetEntry, " + Size, NumLookups, FrozenTime);
+    Bench::ReportLatency("FrozenIni TryGetEntry(IniKey), " + Size, NumLookups, FrozenKeyTime);
+    std::printf("%-48s %10zu bytes\n", ("IniFile heap, " + Size).c_str(), Counting.GetLiveBytes());
+    std::printf("%-48s %10zu bytes\n", ("FrozenIni buffer, " + Size).c_str(), Frozen.GetMemoryUsage());
+
+    REQUIRE(Found == NumLookups * 3 * 4);
+  }
+}
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+#include <filesystem>
+
+TEST_CASE("SaveIncremental after one change against WriteFile", "[.][benchmark][incremental]")
+{
+  const std::string Text = Bench::MakeIniText(10000, 20);
+  const std::string FileName = Bench::WriteTempFile("IniFileBench_Incremental.ini", Text);
+  const std::string OutFileName = FileName + ".out";
+
+  IniFile Ini(FileName);
+  IniEntry &Changed = Ini.TryGetSection("Section5000")->get()["Key0"];
+
+  int Value = 0;
+  const double IncrementalTime = Bench::BestOf(5, [&]() {
+    Changed.Clear();
+    Changed.AddValue(std::to_string(++Value));
+    REQUIRE(Ini.SaveIncremental());
+  });
+
+  const double WriteFileTime = Bench::BestOf(5, [&]() { REQUIRE(Ini.WriteFile(OutFileName)); });
+
+  Bench::ReportThroughput("SaveIncremental, one value of 10000 sections", Text.size(), IncrementalTime);
+  Bench::ReportThroughput("WriteFile, 10000 sections", Text.size(), WriteFileTime);
+
+  std::filesystem::remove(FileName);
+  std::filesystem::remove(OutFileName);
+}
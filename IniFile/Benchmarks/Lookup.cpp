@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+#include <array>
+#include <random>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  // 50 hot Section.Key paths, as a service would declare them
+  constexpr std::string_view HotSections[] = {"Server", "Client", "Database", "Cache", "Logging", "Metrics", "Auth", "Storage", "Queue", "Timeouts"};
+  constexpr std::string_view HotEntries[] = {"Port", "Host", "RequestMs", "Retries", "Threads"};
+  constexpr std::size_t      NumEntries = std::size(HotEntries);
+
+  template<std::size_t... Indices>
+  constexpr std::array<IniKey, sizeof...(Indices)> MakeHotKeys(std::index_sequence<Indices...>)
+  {
+    return {IniKey(HotSections[Indices / NumEntries], HotEntries[Indices % NumEntries])...};
+  }
+
+  constexpr auto HotKeys = MakeHotKeys(std::make_index_sequence<std::size(HotSections) * NumEntries>());
+}  // namespace
+
+TEST_CASE("TryGetSection and TryGetEntry latency at 10, 1k and 100k keys", "[.][benchmark][lookup]")
+{
+  constexpr std::size_t NumLookups = 1000000;
+
+  for (std::size_t NumKeys : {10, 1000, 100000})
+  {
+    std::vector<std::string> Keys;
+    std::vector<std::string> Missing;
+    for (std::size_t i = 0; i < NumKeys; ++i)
+    {
+      Keys.push_back("Key_" + std::to_string(i));
+      Missing.push_back("Missing_" + std::to_string(i));
+    }
+
+    // One section holding every key, and one section per key
+    std::string Text = "[Entries]\n";
+    for (const std::string &Key : Keys)
+      Text += Key + "=Value\n";
+    for (const std::string &Key : Keys)
+      Text += "\n[" + Key + "]\n";
+
+    IniFile Ini;
+    Ini.ParseBuffer(Text);
+
+    // Visit the keys in a random order so large tables miss the cache
+    std::vector<std::size_t> Order(NumLookups);
+    std::mt19937             Random(42);
+    for (std::size_t &Index : Order)
+      Index = Random() % NumKeys;
+
+    IniSection &Entries = Ini.TryGetSection("Entries").value().get();
+    std::size_t Found = 0;
+
+    const double EntryHitTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Entries.TryGetEntry(Keys[Index]).has_value();
+    });
+
+    const double EntryMissTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Entries.TryGetEntry(Missing[Index]).has_value();
+    });
+
+    const double SectionHitTime = Bench::BestOf(3, [&]() {
+      for (std::size_t Index : Order)
+        Found += Ini.TryGetSection(Keys[Index]).has_value();
+    });
+
+    const std::string Size = std::to_string(NumKeys) + " keys";
+    Bench::ReportLatency("TryGetEntry hit, " + Size, NumLookups, EntryHitTime);
+    Bench::ReportLatency("TryGetEntry miss, " + Size, NumLookups, EntryMissTime);
+    Bench::ReportLatency("TryGetSection hit, " + Size, NumLookups, SectionHitTime);
+
+    REQUIRE(Found == NumLookups * 3 * 2);
+  }
+}
+
+
+TEST_CASE("IniKey and handle lookups against TryGetSection and TryGetEntry", "[.][benchmark][lookup][hashedkey][handle]")
+{
+  constexpr std::size_t NumLookups = 1000000;
+
+  // The hot sections among a few hundred others, each with a few dozen keys
+  std::string Text = Bench::MakeIniText(500, 40);
+  for (std::string_view Section : HotSections)
+  {
+    Text += "[" + std::string(Section) + "]\n";
+    for (std::size_t i = 0; i < 40; ++i)
+      Text += "Other" + std::to_string(i) + "=Value\n";
+    for (std::string_view Entry : HotEntries)
+      Text += std::string(Entry) + "=Value\n";
+    Text += "\n";
+  }
+
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  std::vector<std::size_t> Order(NumLookups);
+  std::mt19937             Random(42);
+  for (std::size_t &Index : Order)
+    Index = Random() % HotKeys.size();
+
+  std::size_t Found = 0;
+
+  const double StringTime = Bench::BestOf(3, [&]() {
+    for (std::size_t Index : Order)
+    {
+      const IniKey &Key = HotKeys[Index];
+      Found += Ini.TryGetSection(Key.Section.Name)->get().TryGetEntry(Key.Entry.Name).has_value();
+    }
+  });
+
+  const double HashedTime = Bench::BestOf(3, [&]() {
+    for (std::size_t Index : Order)
+      Found += Ini.TryGetEntry(HotKeys[Index]).has_value();
+  });
+
+  // Resolved once up front, every read is two array indexes
+  std::vector<IniEntryHandle> Handles;
+  for (const IniKey &Key : HotKeys)
+    Handles.push_back(Ini.Resolve(Key));
+
+  const double HandleTime = Bench::BestOf(3, [&]() {
+    for (std::size_t Index : Order)
+      Found += Ini.TryGetEntry(Handles[Index]).has_value();
+  });
+
+  Bench::ReportLatency("TryGetSection + TryGetEntry, 50 hot keys", NumLookups, StringTime);
+  Bench::ReportLatency("TryGetEntry(IniKey), 50 hot keys", NumLookups, HashedTime);
+  Bench::ReportLatency("TryGetEntry(IniEntryHandle), 50 hot keys", NumLookups, HandleTime);
+
+  REQUIRE(Found == NumLookups * 3 * 3);
+}
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/IniMappedFile.h>
+
+namespace
+{
+  const char *ReadModeName(IniReadMode Mode)
+  {
+    switch (Mode)
+    {
+      case IniReadMode::Buffered:
+        return "Buffered";
+      case IniReadMode::Mapped:
+        return "Mapped";
+      case IniReadMode::MappedSequential:
+        return "MappedSequential";
+      default:
+        return "MappedPopulate";
+    }
+  }
+}  // namespace
+
+TEST_CASE("Reading a large file through each IniReadMode", "[.][benchmark][mmap]")
+{
+  const std::string Text = Bench::MakeIniText(50000, 16);
+  const std::string Path = Bench::WriteTempFile("IniFileBench_MappedRead.ini", Text);
+
+  std::size_t LineCount = 0;
+
+  const double GetlineTime = Bench::BestOf(3, [&]() {
+    std::ifstream In(Path, std::ios_base::in);
+    std::string   Line;
+
+    LineCount = 0;
+    while (std::getline(In, Line))
+      ++LineCount;
+  });
+  Bench::ReportThroughput("std::getline, line count only", Text.size(), GetlineTime);
+
+  for (IniReadMode Mode : {IniReadMode::Buffered, IniReadMode::Mapped, IniReadMode::MappedSequential, IniReadMode::MappedPopulate})
+  {
+    std::size_t NewLines = 0;
+
+    const double ReadTime = Bench::BestOf(3, [&]() {
+      IniMappedFile File;
+      File.Open(Path, Mode);
+
+      const std::string_view View = File.GetView();
+      NewLines = static_cast<std::size_t>(std::count(View.begin(), View.end(), '\n'));
+    });
+
+    const double ParseTime = Bench::BestOf(3, [&]() { IniFile Ini(Path, IniParseMode::Scanner, Mode); });
+
+    Bench::ReportThroughput(std::string(ReadModeName(Mode)) + ", line count only", Text.size(), ReadTime);
+    Bench::ReportThroughput(std::string(ReadModeName(Mode)) + ", full parse", Text.size(), ParseTime);
+
+    REQUIRE(NewLines == LineCount);
+  }
+
+  std::filesystem::remove(Path);
+}
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+TEST_CASE("ParseBuffer against writing the buffer to a temporary file first", "[.][benchmark][buffer]")
+{
+  // Small configs, like the ones received over RPC, and one large generated file
+  for (std::size_t NumSections : {std::size_t(4), std::size_t(256), std::size_t(20000)})
+  {
+    const std::string Text = Bench::MakeIniText(NumSections, 12);
+    const int         Iterations = NumSections < 1000 ? 200 : 5;
+
+    std::size_t FromBuffer = 0;
+    std::size_t FromFile = 0;
+
+    const double BufferTime = Bench::BestOf(Iterations, [&]() {
+      IniFile Ini;
+      Ini.ParseBuffer(Text);
+      FromBuffer = static_cast<std::size_t>(std::distance(Ini.begin(), Ini.end()));
+    });
+
+    const double TempFileTime = Bench::BestOf(Iterations, [&]() {
+      const std::string Path = Bench::WriteTempFile("IniFileBench_ParseBuffer.ini", Text);
+      IniFile           Ini(Path);
+      FromFile = static_cast<std::size_t>(std::distance(Ini.begin(), Ini.end()));
+      std::filesystem::remove(Path);
+    });
+
+    const std::string Label = std::to_string(NumSections) + " sections";
+    Bench::ReportThroughput("ParseBuffer, " + Label, Text.size(), BufferTime);
+    Bench::ReportThroughput("Temp file round trip, " + Label, Text.size(), TempFileTime);
+
+    REQUIRE(FromBuffer == FromFile);
+  }
+}
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/IniScanner.h>
+
+#include <sstream>
+
+namespace
+{
+  struct CountingHandler
+  {
+    std::size_t Sections = 0;
+    std::size_t Entries = 0;
+
+    void OnSection(std::string_view)
+    {
+      ++Sections;
+    }
+
+    void OnEntry(std::string_view, std::string_view, bool)
+    {
+      ++Entries;
+    }
+  };
+}  // namespace
+
+TEST_CASE("Block stream reader against one std::getline call per line", "[.][benchmark][stream]")
+{
+  const std::string Text = Bench::MakeIniText(50000, 12);
+  const std::string Path = Bench::WriteTempFile("IniFileBench_ParseStream.ini", Text);
+
+  CountingHandler GetlineCounts;
+  CountingHandler BlockCounts;
+
+  const double GetlineTime = Bench::BestOf(3, [&]() {
+    std::ifstream In(Path, std::ios_base::in | std::ios_base::binary);
+    std::string   Line;
+    IniScanner    Scanner;
+
+    GetlineCounts = CountingHandler();
+    while (std::getline(In, Line))
+      Scanner.ScanLine(Line, GetlineCounts);
+  });
+
+  for (std::size_t BlockSize : {std::size_t(4) << 10, std::size_t(64) << 10, std::size_t(1) << 20})
+  {
+    const double BlockTime = Bench::BestOf(3, [&]() {
+      std::ifstream In(Path, std::ios_base::in | std::ios_base::binary);
+      IniScanner    Scanner;
+
+      BlockCounts = CountingHandler();
+      Scanner.ScanStream(In, BlockCounts, BlockSize);
+    });
+
+    Bench::ReportThroughput("ScanStream, " + std::to_string(BlockSize >> 10) + " KB blocks, scan only", Text.size(), BlockTime);
+
+    REQUIRE(BlockCounts.Sections == GetlineCounts.Sections);
+    REQUIRE(BlockCounts.Entries == GetlineCounts.Entries);
+  }
+
+  Bench::ReportThroughput("std::getline + ScanLine, scan only", Text.size(), GetlineTime);
+
+  const double ParseTime = Bench::BestOf(3, [&]() {
+    std::ifstream In(Path, std::ios_base::in | std::ios_base::binary);
+    IniFile       Ini;
+    Ini.ParseStream(In);
+  });
+  Bench::ReportThroughput("IniFile::ParseStream, full parse", Text.size(), ParseTime);
+
+  std::filesystem::remove(Path);
+}
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniSharedSnapshot.h>
+#include <IniFile/IniWatcher.h>
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace
+{
+  // Runs Body(ThreadIndex) on NumThreads threads and returns the wall time
+  template<class Fn>
+  double RunThreads(std::size_t NumThreads, Fn &&Body)
+  {
+    return Bench::BestOf(3, [&]() {
+      std::vector<std::thread> Threads;
+      Threads.reserve(NumThreads);
+
+      for (std::size_t t = 0; t < NumThreads; ++t)
+        Threads.emplace_back(Body, t);
+
+      for (std::thread &Thread : Threads)
+        Thread.join();
+    });
+  }
+}  // namespace
+
+TEST_CASE("Lookup scaling across threads", "[.][benchmark][sharedsnapshot]")
+{
+  constexpr std::size_t LookupsPerThread = 200000;
+
+  const std::string Text = Bench::MakeIniText(2000, 12);
+  const std::string FileName = Bench::WriteTempFile("IniFileBench_SharedSnapshot.ini", Text);
+
+  IniFile                 Ini(FileName);
+  const IniSharedSnapshot Snapshot(Ini);
+  IniWatcher              Watcher(FileName);
+  std::mutex              IniMutex;
+
+  std::vector<std::pair<std::string, std::string>> Paths;
+  for (auto SectionIt = Ini.cbegin(); SectionIt != Ini.cend(); ++SectionIt)
+    for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+      Paths.emplace_back(SectionIt->first, EntryIt->first);
+
+  std::vector<IniKey> Keys;
+  for (const auto &Path : Paths)
+    Keys.emplace_back(Path.first, Path.second);
+
+  std::vector<std::size_t> Order(LookupsPerThread);
+  std::mt19937             Random(42);
+  for (std::size_t &Index : Order)
+    Index = Random() % Keys.size();
+
+  std::atomic<std::size_t> Found{0};
+
+  for (std::size_t NumThreads : {1, 2, 4, 8, 16, 32, 64})
+  {
+    const std::size_t Lookups = NumThreads * LookupsPerThread;
+    const std::string Label = ", " + std::to_string(NumThreads) + " threads";
+
+    // The status quo: one IniFile behind a mutex
+    const double MutexTime = RunThreads(NumThreads, [&](std::size_t) {
+      std::size_t Mine = 0;
+      for (std::size_t Index : Order)
+      {
+        std::lock_guard<std::mutex> Lock(IniMutex);
+        Mine += Ini.TryGetEntry(Keys[Index]).has_value();
+      }
+      Found += Mine;
+    });
+
+    // One copy per thread, then no shared writes at all
+    const double SnapshotTime = RunThreads(NumThreads, [&](std::size_t) {
+      const IniSharedSnapshot Mine = Snapshot;
+      std::size_t             MineFound = 0;
+      for (std::size_t Index : Order)
+        MineFound += Mine.TryGetEntry(Keys[Index]).has_value();
+      Found += MineFound;
+    });
+
+    // Picks up reloads, one relaxed load per lookup
+    const double ReaderTime = RunThreads(NumThreads, [&](std::size_t) {
+      IniWatcher::Reader Reader(Watcher);
+      std::size_t        Mine = 0;
+      for (std::size_t Index : Order)
+        Mine += Reader.Get().TryGetEntry(Keys[Index]).has_value();
+      Found += Mine;
+    });
+
+    // GetSnapshot per lookup, every thread bumps the same counters
+    const double GetSnapshotTime = RunThreads(NumThreads, [&](std::size_t) {
+      std::size_t Mine = 0;
+      for (std::size_t Index : Order)
+        Mine += Watcher.GetSnapshot()->TryGetEntry(Keys[Index]).has_value();
+      Found += Mine;
+    });
+
+    // Aggregate cost: wall time over every lookup made by every thread
+    Bench::ReportLatency("Mutex + IniFile" + Label, Lookups, MutexTime);
+    Bench::ReportLatency("IniSharedSnapshot" + Label, Lookups, SnapshotTime);
+    Bench::ReportLatency("IniWatcher::Reader" + Label, Lookups, ReaderTime);
+    Bench::ReportLatency("IniWatcher::GetSnapshot" + Label, Lookups, GetSnapshotTime);
+  }
+
+  REQUIRE(Found == 127 * LookupsPerThread * 4 * 3);
+  std::filesystem::remove(FileName);
+}
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/FrozenIni.h>
+#include <IniFile/IniFile.h>
+
+#include <filesystem>
+
+TEST_CASE("Cold start from a snapshot against parsing and the binary cache", "[.][benchmark][snapshot]")
+{
+  for (std::size_t NumSections : {100, 10000})
+  {
+    const std::string Text = Bench::MakeIniText(NumSections, 20);
+    const std::string FileName = Bench::WriteTempFile("IniFileBench_Snapshot.ini", Text);
+    const std::string CacheFileName = FileName + ".cache";
+    const std::string SnapshotFileName = FileName + ".snapshot";
+
+    {
+      IniFile Ini(FileName);
+      Ini.WriteCache(FileName, CacheFileName);
+      Ini.Freeze().WriteSnapshot(SnapshotFileName);
+    }
+
+    // Each run opens the file and reads one value, as a process starting up would
+    const double ParseTime = Bench::BestOf(5, [&]() {
+      IniFile Ini(FileName);
+      REQUIRE(Ini.TryGetSection("Section0")->get().TryGetEntry("Key0").has_value());
+    });
+
+    const double CacheTime = Bench::BestOf(5, [&]() {
+      IniFile Ini;
+      REQUIRE(Ini.ReadCache(FileName, CacheFileName));
+      REQUIRE(Ini.TryGetSection("Section0")->get().TryGetEntry("Key0").has_value());
+    });
+
+    const double SnapshotTime = Bench::BestOf(5, [&]() {
+      FrozenIni Snapshot;
+      REQUIRE(Snapshot.OpenSnapshot(SnapshotFileName));
+      REQUIRE(Snapshot.TryGetEntry("Section0", "Key0").has_value());
+    });
+
+    const std::string Size = std::to_string(NumSections) + " sections";
+    Bench::ReportThroughput("ReadFile + lookup, " + Size, Text.size(), ParseTime);
+    Bench::ReportThroughput("ReadCache + lookup, " + Size, Text.size(), CacheTime);
+    Bench::ReportThroughput("OpenSnapshot + lookup, " + Size, Text.size(), SnapshotTime);
+    std::printf("%-48s %10zu bytes\n", ("Snapshot file, " + Size).c_str(), static_cast<std::size_t>(std::filesystem::file_size(SnapshotFileName)));
+
+    std::filesystem::remove(FileName);
+    std::filesystem::remove(CacheFileName);
+    std::filesystem::remove(SnapshotFileName);
+  }
+}
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniSubscriptions.h>
+
+#include <functional>
+
+namespace
+{
+  // NumChanges values of the text made by MakeIniText(10000, 13) changed, one
+  // every 100 entries
+  std::string ChangeValues(std::string Text, std::size_t NumChanges)
+  {
+    for (std::size_t i = 0; i < NumChanges; ++i)
+    {
+      const std::string Value = "\"SomeValue_" + std::to_string(i * 130) + "\"";
+      Text.replace(Text.find(Value), Value.size(), "\"Changed_" + std::to_string(i * 130) + "\"");
+    }
+
+    return Text;
+  }
+}  // namespace
+
+TEST_CASE("Dispatching changes to one subscription per key", "[.][benchmark][subscriptions]")
+{
+  const std::string Text = Bench::MakeIniText(10000, 13);
+
+  IniFile Old;
+  Old.ParseBuffer(Text);
+
+  std::size_t Called = 0;
+
+  // Every key and every section has a subscription
+  IniSubscriptions                   Subscriptions;
+  std::vector<std::function<void()>> Broadcast;
+  for (auto SectionIt = Old.cbegin(); SectionIt != Old.cend(); ++SectionIt)
+  {
+    Subscriptions.SubscribeSection(SectionIt->first, [&Called](const IniDiff::SectionChange &) { ++Called; });
+    Broadcast.emplace_back([&Called]() { ++Called; });
+
+    for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+    {
+      Subscriptions.Subscribe(SectionIt->first, EntryIt->first, [&Called](std::string_view, const IniDiff::EntryChange &) { ++Called; });
+      Broadcast.emplace_back([&Called]() { ++Called; });
+    }
+  }
+
+  const std::string Count = std::to_string(Subscriptions.GetNumSubscriptions()) + " subscriptions";
+
+  for (std::size_t NumChanges : {1, 10, 1000})
+  {
+    IniFile New;
+    New.ParseBuffer(ChangeValues(Text, NumChanges));
+
+    const IniDiff Diff(Old, New);
+    REQUIRE(Diff.GetNumEntryChanges() == NumChanges);
+
+    Called = 0;
+    const double DispatchTime = Bench::BestOf(5, [&]() {
+      Subscriptions.Dispatch(Diff);
+    });
+    REQUIRE(Called == 5 * 2 * NumChanges);
+
+    Bench::ReportLatency("Dispatch, " + std::to_string(NumChanges) + " changed keys, " + Count, 1, DispatchTime);
+  }
+
+  // What a "config changed" broadcast costs: every listener is called
+  const double BroadcastTime = Bench::BestOf(5, [&]() {
+    for (const std::function<void()> &Listener : Broadcast)
+      Listener();
+  });
+
+  Bench::ReportLatency("Broadcast to every listener, " + Count, 1, BroadcastTime);
+}
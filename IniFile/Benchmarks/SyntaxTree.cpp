@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/IniSyntaxTree.h>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Loading a large file as an IniSyntaxTree against an IniFile", "[.][benchmark][syntaxtree]")
+{
+  const std::string Text = Bench::MakeIniText(20000, 12);
+
+  const double TreeTime = Bench::BestOf(3, [&]() {
+    IniSyntaxTree Tree;
+    Tree.ParseBuffer(Text);
+  });
+
+  const double FileTime = Bench::BestOf(3, [&]() {
+    IniFile Ini;
+    Ini.ParseBuffer(Text);
+  });
+
+  Bench::ReportThroughput("IniSyntaxTree::ParseBuffer", Text.size(), TreeTime);
+  Bench::ReportThroughput("IniFile::ParseBuffer", Text.size(), FileTime);
+}
+
+TEST_CASE("IniSyntaxTree lookups against IniFile lookups", "[.][benchmark][syntaxtree]")
+{
+  const std::string Text = Bench::MakeIniText(20000, 12);
+
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Text);
+
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  std::vector<std::pair<std::string, std::string>> Paths;
+  for (std::size_t i = 0; i < 100000; ++i)
+    Paths.emplace_back("Section" + std::to_string(i * 7919 % 20000), "Key" + std::to_string(i % 12));
+
+  std::size_t TreeFound = 0;
+  std::size_t FileFound = 0;
+
+  const double TreeTime = Bench::BestOf(5, [&]() {
+    for (const auto &Path : Paths)
+      TreeFound += Tree.TryGetEntry(Path.first, Path.second).has_value();
+  });
+
+  const double FileTime = Bench::BestOf(5, [&]() {
+    for (const auto &Path : Paths)
+    {
+      auto Section = Ini.TryGetSection(Path.first);
+      FileFound += Section && Section->get().TryGetEntry(Path.second).has_value();
+    }
+  });
+
+  Bench::ReportLatency("IniSyntaxTree::TryGetEntry", Paths.size(), TreeTime);
+  Bench::ReportLatency("IniFile, TryGetSection and TryGetEntry", Paths.size(), FileTime);
+
+  REQUIRE(TreeFound == FileFound);
+}
+
+TEST_CASE("Writing an IniSyntaxTree back after one edit", "[.][benchmark][syntaxtree]")
+{
+  const std::string Text = Bench::MakeIniText(20000, 12);
+
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Text);
+  REQUIRE(Tree.SetValue("Section10000", "Key0", "changed"));
+
+  std::size_t Written = 0;
+  const double TreeTime = Bench::BestOf(5, [&]() { Written = Tree.GetText().size(); });
+
+  Bench::ReportThroughput("IniSyntaxTree::GetText", Written, TreeTime);
+}
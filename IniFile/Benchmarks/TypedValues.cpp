@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+#include <string>
+#include <vector>
+
+TEST_CASE("Typed getters against copying the value and calling stoi/stod", "[.][benchmark][typed]")
+{
+  constexpr std::size_t NumEntries = 1000;
+  constexpr int         Passes = 1000;
+
+  std::string Text = "[Numbers]\n";
+  for (std::size_t i = 0; i < NumEntries; ++i)
+  {
+    Text += "Int" + std::to_string(i) + "=" + std::to_string(i * 7919) + "\n";
+    Text += "Double" + std::to_string(i) + "=" + std::to_string(i * 0.25) + "\n";
+  }
+
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Numbers").value().get();
+
+  std::vector<IniEntry *> Ints;
+  std::vector<IniEntry *> Doubles;
+  for (std::size_t i = 0; i < NumEntries; ++i)
+  {
+    Ints.push_back(&Section["Int" + std::to_string(i)]);
+    Doubles.push_back(&Section["Double" + std::to_string(i)]);
+  }
+
+  constexpr std::size_t NumReads = NumEntries * Passes;
+  long long             IntSum = 0;
+  double                DoubleSum = 0.0;
+
+  auto TimeReads = [&](const char *Label, auto &&Read) {
+    const double Seconds = Bench::BestOf(3, [&]() {
+      for (int p = 0; p < Passes; ++p)
+        Read();
+    });
+
+    Bench::ReportLatency(Label, NumReads, Seconds);
+  };
+
+  TimeReads("std::stoi(*TryGetValue())", [&]() {
+    for (IniEntry *Entry : Ints)
+      IntSum += std::stoi(*Entry->TryGetValue());
+  });
+
+  // GetAs converts every time, GetInt and GetDouble would hit their cache
+  TimeReads("GetAs<std::int64_t>()", [&]() {
+    for (IniEntry *Entry : Ints)
+      IntSum += *Entry->GetAs<std::int64_t>();
+  });
+
+  TimeReads("std::stod(*TryGetValue())", [&]() {
+    for (IniEntry *Entry : Doubles)
+      DoubleSum += std::stod(*Entry->TryGetValue());
+  });
+
+  TimeReads("GetAs<double>()", [&]() {
+    for (IniEntry *Entry : Doubles)
+      DoubleSum += *Entry->GetAs<double>();
+  });
+
+  REQUIRE(IntSum > 0);
+  REQUIRE(DoubleSum > 0.0);
+}
+
+TEST_CASE("Repeated GetInt of one entry with and without the conversion cache", "[.][benchmark][typed][cache]")
+{
+  constexpr std::size_t NumReads = 10000000;
+
+  IniFile Ini;
+  Ini.ParseBuffer("[Timeouts]\nRequestMs=2500\n");
+  const IniEntry &Entry = Ini.TryGetSection("Timeouts")->get()["RequestMs"];
+
+  long long Sum = 0;
+
+  const double ParseTime = Bench::BestOf(3, [&]() {
+    for (std::size_t i = 0; i < NumReads; ++i)
+      Sum += *Entry.GetAs<std::int64_t>();
+  });
+
+  const double CachedTime = Bench::BestOf(3, [&]() {
+    for (std::size_t i = 0; i < NumReads; ++i)
+      Sum += *Entry.GetInt();
+  });
+
+  Bench::ReportLatency("GetAs<std::int64_t>(), parsed every time", NumReads, ParseTime);
+  Bench::ReportLatency("GetInt(), cached", NumReads, CachedTime);
+
+  REQUIRE(Sum == 2500LL * NumReads * 3 * 2);
+}
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniWatcher.h>
+
+#include <filesystem>
+#include <thread>
+
+TEST_CASE("IniWatcher reload latency and snapshot reads", "[.][benchmark][watcher]")
+{
+  const std::string Text = Bench::MakeIniText(10000, 12);
+  const std::string FileName = Bench::WriteTempFile("IniFileBench_Watcher.ini", Text);
+
+  IniWatcher Watcher(FileName);
+
+  // From the new file being renamed into place to its snapshot being published
+  const double ReloadTime = Bench::BestOf(5, [&]() {
+    const std::uint64_t Generation = Watcher.GetGeneration();
+    const std::string   NewFileName = Bench::WriteTempFile("IniFileBench_Watcher.ini.new", Text + "[Reload" + std::to_string(Generation) + "]\nKey=1\n");
+
+    std::filesystem::rename(NewFileName, FileName);
+    while (Watcher.GetGeneration() == Generation)
+      std::this_thread::yield();
+  });
+
+  constexpr std::size_t Reads = 1000000;
+
+  std::size_t Found = 0;
+  const double SnapshotTime = Bench::BestOf(5, [&]() {
+    for (std::size_t i = 0; i < Reads; ++i)
+      Found += Watcher.GetSnapshot()->HasSection("Section5000");
+  });
+
+  Bench::ReportThroughput("Reload after rename", Text.size(), ReloadTime);
+  Bench::ReportLatency("GetSnapshot and one lookup", Reads, SnapshotTime);
+
+  REQUIRE(Found == 5 * Reads);
+  std::filesystem::remove(FileName);
+}
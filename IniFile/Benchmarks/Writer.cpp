@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/Benchmarks/BenchmarkUtils.h>
+#include <IniFile/IniFile.h>
+
+#include <filesystem>
+#include <sstream>
+
+TEST_CASE("WriteTo and WriteFile throughput", "[.][benchmark][writer]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Bench::MakeIniText(10000, 20));
+
+  std::size_t Bytes = 0;
+  {
+    std::ostringstream Out;
+    Ini.WriteTo(Out);
+    Bytes = Out.str().size();
+  }
+
+  // What a writer built from operator<< calls, one per token, would do
+  const double StreamTime = Bench::BestOf(5, [&]() {
+    std::ostringstream Out;
+    for (auto SectionIt = Ini.cbegin(); SectionIt != Ini.cend(); ++SectionIt)
+    {
+      Out << '[' << SectionIt->first << "]\n";
+      for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+        for (std::size_t v = 0; v < EntryIt->second.GetValueCount(); ++v)
+          Out << (v > 0 ? "+" : "") << EntryIt->first << '=' << *EntryIt->second.GetValueView(v) << '\n';
+      Out << '\n';
+    }
+    REQUIRE(Out.tellp() == static_cast<std::streamoff>(Bytes));
+  });
+
+  const double WriteToTime = Bench::BestOf(5, [&]() {
+    std::ostringstream Out;
+    REQUIRE(Ini.WriteTo(Out));
+  });
+
+  const std::string FileName = (std::filesystem::temp_directory_path() / "IniFileBench_Writer.ini").string();
+  const double      WriteFileTime = Bench::BestOf(5, [&]() { REQUIRE(Ini.WriteFile(FileName)); });
+  std::filesystem::remove(FileName);
+
+  Bench::ReportThroughput("operator<< per token, std::ostringstream", Bytes, StreamTime);
+  Bench::ReportThroughput("WriteTo, std::ostringstream", Bytes, WriteToTime);
+  Bench::ReportThroughput("WriteFile", Bytes, WriteFileTime);
+}
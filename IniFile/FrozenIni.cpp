@@ -0,0 +1,684 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "FrozenIni.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+struct FrozenIni::Header
+{
+  std::uint32_t Magic;
+  std::uint32_t Version;
+  std::uint32_t TotalSize;
+  std::uint32_t SectionCount;
+  std::uint32_t EntryCount;
+  std::uint32_t ValueCount;
+  std::uint32_t SectionBuckets;
+  std::uint32_t EntryBuckets;
+  std::uint32_t SectionsOffset;
+  std::uint32_t EntriesOffset;
+  std::uint32_t ValuesOffset;
+  std::uint32_t SectionDisplacementsOffset;
+  std::uint32_t SectionOrderOffset;
+  std::uint32_t EntryDisplacementsOffset;
+  std::uint32_t EntryOrderOffset;
+  std::uint32_t TextOffset;
+  std::uint32_t TextSize;
+};
+
+// Records are stored in the slot order of their perfect hash, so a lookup goes
+// straight from the hash to the record. The order arrays give file order.
+struct FrozenIni::SectionRecord
+{
+  std::uint64_t Hash;
+  std::uint32_t NameOffset;
+  std::uint32_t NameLength;
+  std::uint32_t FirstEntry;  // into the entry order array
+  std::uint32_t EntryCount;
+};
+
+struct FrozenIni::EntryRecord
+{
+  std::uint64_t Hash;  // CombineHash of the section name and the key
+  std::uint32_t Section;
+  std::uint32_t KeyOffset;
+  std::uint32_t KeyLength;
+  std::uint32_t FirstValue;
+  std::uint32_t ValueCount;
+  std::uint32_t Padding;
+};
+
+struct FrozenIni::ValueRecord
+{
+  std::uint32_t Offset;
+  std::uint32_t Length;
+};
+
+namespace
+{
+  constexpr std::uint32_t SnapshotMagic = 0x494E5246u;  // "FRNI"
+  constexpr std::uint32_t SnapshotVersion = 2;  // 2: IniHashString finalizer changed
+
+  constexpr std::uint64_t Golden = 0x9E3779B97F4A7C15ull;
+
+  // Hash of a Section.Key pair from the hashes of its parts, so an IniKey
+  // needs no string hashing at all
+  std::uint64_t CombineHash(std::uint64_t SectionHash, std::uint64_t KeyHash)
+  {
+    const std::uint64_t Hash = (SectionHash * Golden) ^ KeyHash;
+    return Hash ^ (Hash >> 29);
+  }
+
+  std::uint64_t HashName(std::string_view Name)
+  {
+    return static_cast<std::uint64_t>(IniStringHash{}(Name));
+  }
+
+  // Lemire's multiply-shift reduction of the top 32 bits of Hash to [0, Range)
+  std::uint32_t Reduce(std::uint64_t Hash, std::uint32_t Range)
+  {
+    return static_cast<std::uint32_t>(((Hash >> 32) * Range) >> 32);
+  }
+
+  std::uint32_t BucketOf(std::uint64_t Hash, std::uint32_t NumBuckets)
+  {
+    return static_cast<std::uint32_t>(((Hash & 0xFFFFFFFFull) * NumBuckets) >> 32);
+  }
+
+  std::uint32_t SlotOf(std::uint64_t Hash, std::uint32_t Displacement, std::uint32_t NumSlots)
+  {
+    std::uint64_t Mixed = Hash ^ ((Displacement + 1ull) * Golden);
+    Mixed ^= Mixed >> 33;
+    Mixed *= 0xFF51AFD7ED558CCDull;
+    Mixed ^= Mixed >> 33;
+    return Reduce(Mixed, NumSlots);
+  }
+
+  // About two keys per bucket, the table itself has exactly one slot per key
+  std::uint32_t BucketCountFor(std::size_t NumKeys)
+  {
+    return static_cast<std::uint32_t>(std::max<std::size_t>(1, (NumKeys + 1) / 2));
+  }
+
+  // Hash and displace: keys are split into buckets by their hash, and buckets,
+  // largest first, each get the first displacement that sends all of their
+  // keys to free slots. Slots[Slot] is the index of the key that landed there.
+  void BuildPerfectHash(const std::vector<std::uint64_t> &Hashes, std::uint32_t NumBuckets, std::uint32_t *Displacements, std::uint32_t *Slots)
+  {
+    const auto NumKeys = static_cast<std::uint32_t>(Hashes.size());
+    if (NumKeys == 0)
+      return;
+
+    // Keys with the same 64 bit hash can never be told apart
+    std::vector<std::uint64_t> Sorted(Hashes);
+    std::sort(Sorted.begin(), Sorted.end());
+    if (std::adjacent_find(Sorted.begin(), Sorted.end()) != Sorted.end())
+      throw std::runtime_error("FrozenIni: two keys have the same hash");
+
+    // Keys grouped by bucket, counting sort
+    std::vector<std::uint32_t> BucketStart(NumBuckets + 1, 0);
+    for (std::uint64_t Hash : Hashes)
+      ++BucketStart[BucketOf(Hash, NumBuckets) + 1];
+    for (std::uint32_t b = 0; b < NumBuckets; ++b)
+      BucketStart[b + 1] += BucketStart[b];
+
+    std::vector<std::uint32_t> BucketKeys(NumKeys);
+    std::vector<std::uint32_t> Fill(BucketStart.begin(), BucketStart.end() - 1);
+    for (std::uint32_t k = 0; k < NumKeys; ++k)
+      BucketKeys[Fill[BucketOf(Hashes[k], NumBuckets)]++] = k;
+
+    std::vector<std::uint32_t> Order(NumBuckets);
+    for (std::uint32_t b = 0; b < NumBuckets; ++b)
+      Order[b] = b;
+    std::stable_sort(Order.begin(), Order.end(), [&BucketStart](std::uint32_t LHS, std::uint32_t RHS) {
+      return BucketStart[LHS + 1] - BucketStart[LHS] > BucketStart[RHS + 1] - BucketStart[RHS];
+    });
+
+    std::vector<bool>          Taken(NumKeys, false);
+    std::vector<std::uint32_t> Candidate;
+
+    for (std::uint32_t Bucket : Order)
+    {
+      const std::uint32_t First = BucketStart[Bucket];
+      const std::uint32_t Last = BucketStart[Bucket + 1];
+      Displacements[Bucket] = 0;
+
+      if (First == Last)
+        continue;
+
+      // Every free slot is reachable eventually, the limit only guards
+      // against a bad hash
+      const std::uint64_t MaxDisplacement = 1024ull + 64ull * NumKeys;
+      bool                Placed = false;
+
+      for (std::uint64_t Displacement = 0; Displacement < MaxDisplacement && !Placed; ++Displacement)
+      {
+        Candidate.clear();
+        Placed = true;
+
+        for (std::uint32_t i = First; i < Last && Placed; ++i)
+        {
+          const std::uint32_t Slot = SlotOf(Hashes[BucketKeys[i]], static_cast<std::uint32_t>(Displacement), NumKeys);
+          Placed = !Taken[Slot] && std::find(Candidate.begin(), Candidate.end(), Slot) == Candidate.end();
+          Candidate.push_back(Slot);
+        }
+
+        if (!Placed)
+          continue;
+
+        Displacements[Bucket] = static_cast<std::uint32_t>(Displacement);
+        for (std::uint32_t i = First; i < Last; ++i)
+        {
+          Taken[Candidate[i - First]] = true;
+          Slots[Candidate[i - First]] = BucketKeys[i];
+        }
+      }
+
+      if (!Placed)
+        throw std::runtime_error("FrozenIni: failed to build the perfect hash");
+    }
+  }
+
+  // Every offset, length and count in a snapshot is 32 bits
+  std::uint32_t ToU32(std::size_t Value)
+  {
+    if (Value > std::numeric_limits<std::uint32_t>::max())
+      throw std::runtime_error("FrozenIni: ini file is too large to freeze");
+
+    return static_cast<std::uint32_t>(Value);
+  }
+
+  std::uint32_t AlignTo8(std::size_t Offset)
+  {
+    return ToU32((Offset + 7) & ~std::size_t(7));
+  }
+}  // namespace
+
+FrozenIni IniFile::Freeze() const
+{
+  return FrozenIni(*this);
+}
+
+FrozenIni::FrozenIni()
+    : m_Header(GetEmptyHeader())
+{}
+
+FrozenIni::FrozenIni(const IniFile &File)
+{
+  // Everything is laid out in file order first, then written into one buffer
+  std::vector<SectionRecord> Sections;
+  std::vector<EntryRecord>   Entries;
+  std::vector<ValueRecord>   Values;
+  std::vector<char>          Text;
+
+  // Checked before the text grows, so the end of every string fits as well
+  auto AddText = [&Text](std::string_view Str) {
+    const std::uint32_t Offset = ToU32(Text.size());
+    ToU32(Text.size() + Str.size());
+    Text.insert(Text.end(), Str.begin(), Str.end());
+    return Offset;
+  };
+
+  for (auto SectionIt = File.cbegin(); SectionIt != File.cend(); ++SectionIt)
+  {
+    const IniSection &     Section = SectionIt->second;
+    const std::string_view Name = SectionIt->first;
+    const auto             SectionIndex = ToU32(Sections.size());
+
+    Sections.push_back({HashName(Name), AddText(Name), ToU32(Name.size()), ToU32(Entries.size()), 0});
+
+    for (auto EntryIt = Section.cbegin(); EntryIt != Section.cend(); ++EntryIt)
+    {
+      const IniEntry &       Entry = EntryIt->second;
+      const std::string_view Key = EntryIt->first;
+
+      EntryRecord Record{CombineHash(Sections.back().Hash, HashName(Key)), SectionIndex, AddText(Key), ToU32(Key.size()), ToU32(Values.size()), 0, 0};
+
+      for (std::size_t v = 0; v < Entry.GetValueCount(); ++v)
+      {
+        const std::string_view Value = *Entry.GetValueView(v);
+        Values.push_back({AddText(Value), ToU32(Value.size())});
+      }
+
+      Record.ValueCount = ToU32(Values.size()) - Record.FirstValue;
+      Entries.push_back(Record);
+    }
+
+    Sections.back().EntryCount = ToU32(Entries.size()) - Sections.back().FirstEntry;
+  }
+
+  Header Head{};
+  Head.Magic = SnapshotMagic;
+  Head.Version = SnapshotVersion;
+  Head.SectionCount = ToU32(Sections.size());
+  Head.EntryCount = ToU32(Entries.size());
+  Head.ValueCount = ToU32(Values.size());
+  Head.SectionBuckets = BucketCountFor(Sections.size());
+  Head.EntryBuckets = BucketCountFor(Entries.size());
+
+  const std::size_t U32 = sizeof(std::uint32_t);
+  Head.SectionsOffset = AlignTo8(sizeof(Header));
+  Head.EntriesOffset = AlignTo8(Head.SectionsOffset + Sections.size() * sizeof(SectionRecord));
+  Head.ValuesOffset = AlignTo8(Head.EntriesOffset + Entries.size() * sizeof(EntryRecord));
+  Head.SectionDisplacementsOffset = AlignTo8(Head.ValuesOffset + Values.size() * sizeof(ValueRecord));
+  Head.SectionOrderOffset = AlignTo8(Head.SectionDisplacementsOffset + Head.SectionBuckets * U32);
+  Head.EntryDisplacementsOffset = AlignTo8(Head.SectionOrderOffset + Sections.size() * U32);
+  Head.EntryOrderOffset = AlignTo8(Head.EntryDisplacementsOffset + Head.EntryBuckets * U32);
+  Head.TextOffset = AlignTo8(Head.EntryOrderOffset + Entries.size() * U32);
+  Head.TextSize = ToU32(Text.size());
+
+  Head.TotalSize = AlignTo8(Head.TextOffset + std::size_t(Head.TextSize));
+
+  m_Storage.assign(Head.TotalSize / sizeof(std::uint64_t), 0);
+  char *Base = reinterpret_cast<char *>(m_Storage.data());
+
+  auto Array = [Base](std::uint32_t Offset) { return reinterpret_cast<std::uint32_t *>(Base + Offset); };
+
+  std::memcpy(Base, &Head, sizeof(Header));
+  if (!Values.empty())
+    std::memcpy(Base + Head.ValuesOffset, Values.data(), Values.size() * sizeof(ValueRecord));
+  if (!Text.empty())
+    std::memcpy(Base + Head.TextOffset, Text.data(), Text.size());
+
+  // Slots[Slot] is the file order index of the record stored at Slot, the
+  // order arrays are the inverse
+  std::vector<std::uint64_t> Hashes;
+  std::vector<std::uint32_t> Slots;
+
+  for (const SectionRecord &Record : Sections)
+    Hashes.push_back(Record.Hash);
+  Slots.assign(Sections.size(), 0);
+  BuildPerfectHash(Hashes, Head.SectionBuckets, Array(Head.SectionDisplacementsOffset), Slots.data());
+
+  std::uint32_t *SectionOrder = Array(Head.SectionOrderOffset);
+  for (std::uint32_t Slot = 0; Slot < Slots.size(); ++Slot)
+  {
+    SectionOrder[Slots[Slot]] = Slot;
+    std::memcpy(Base + Head.SectionsOffset + Slot * sizeof(SectionRecord), &Sections[Slots[Slot]], sizeof(SectionRecord));
+  }
+
+  Hashes.clear();
+  for (const EntryRecord &Record : Entries)
+    Hashes.push_back(Record.Hash);
+  Slots.assign(Entries.size(), 0);
+  BuildPerfectHash(Hashes, Head.EntryBuckets, Array(Head.EntryDisplacementsOffset), Slots.data());
+
+  std::uint32_t *EntryOrder = Array(Head.EntryOrderOffset);
+  for (std::uint32_t Slot = 0; Slot < Slots.size(); ++Slot)
+  {
+    EntryRecord Record = Entries[Slots[Slot]];
+    Record.Section = SectionOrder[Record.Section];
+
+    EntryOrder[Slots[Slot]] = Slot;
+    std::memcpy(Base + Head.EntriesOffset + Slot * sizeof(EntryRecord), &Record, sizeof(EntryRecord));
+  }
+
+  m_Header = reinterpret_cast<const Header *>(Base);
+}
+
+// Moving a std::vector or an IniMappedFile keeps its buffer, so the header
+// pointer stays valid
+FrozenIni::FrozenIni(FrozenIni &&Other) noexcept
+    : m_Storage(std::move(Other.m_Storage))
+    , m_Snapshot(std::move(Other.m_Snapshot))
+    , m_Header(Other.m_Header)
+{
+  Other.m_Storage.clear();
+  Other.m_Header = GetEmptyHeader();
+}
+
+FrozenIni &FrozenIni::operator=(FrozenIni &&Other) noexcept
+{
+  if (this != &Other)
+  {
+    m_Storage = std::move(Other.m_Storage);
+    m_Snapshot = std::move(Other.m_Snapshot);
+    m_Header = Other.m_Header;
+
+    Other.m_Storage.clear();
+    Other.m_Header = GetEmptyHeader();
+  }
+
+  return *this;
+}
+
+bool FrozenIni::HasSection(std::string_view SectionName) const
+{
+  return FindSection(SectionName, HashName(SectionName)).has_value();
+}
+
+std::optional<FrozenIni::SectionView> FrozenIni::TryGetSection(std::string_view SectionName) const
+{
+  const auto Index = FindSection(SectionName, HashName(SectionName));
+  if (!Index)
+    return std::nullopt;
+
+  return SectionView(*this, *Index);
+}
+
+std::optional<FrozenIni::SectionView> FrozenIni::TryGetSection(const IniHashedName &SectionName) const
+{
+  const auto Index = FindSection(SectionName.Name, SectionName.Hash);
+  if (!Index)
+    return std::nullopt;
+
+  return SectionView(*this, *Index);
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::TryGetEntry(std::string_view SectionName, std::string_view Key) const
+{
+  return FindEntry(SectionName, Key, HashName(SectionName), HashName(Key));
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::TryGetEntry(const IniKey &Key) const
+{
+  return FindEntry(Key.Section.Name, Key.Entry.Name, Key.Section.Hash, Key.Entry.Hash);
+}
+
+std::size_t FrozenIni::GetNumSections() const
+{
+  return m_Header->SectionCount;
+}
+
+std::size_t FrozenIni::GetNumEntries() const
+{
+  return m_Header->EntryCount;
+}
+
+FrozenIni::SectionView FrozenIni::GetSection(std::size_t Index) const
+{
+  return SectionView(*this, GetArray<std::uint32_t>(m_Header->SectionOrderOffset)[Index]);
+}
+
+std::size_t FrozenIni::GetMemoryUsage() const
+{
+  return m_Header->TotalSize;
+}
+
+bool FrozenIni::WriteSnapshot(const std::string &FileName) const
+{
+  // Renamed into place, so a process opening the snapshot at the same time
+  // never maps half of it
+  return IniReplaceFile(FileName, std::string_view(reinterpret_cast<const char *>(m_Header), m_Header->TotalSize));
+}
+
+bool FrozenIni::OpenSnapshot(const std::string &FileName, IniReadMode ReadMode)
+{
+  *this = FrozenIni();
+
+  IniMappedFile Snapshot;
+  if (!Snapshot.Open(FileName, ReadMode))
+    return false;
+
+  const std::string_view Contents = Snapshot.GetView();
+  if (Contents.size() < sizeof(Header) || reinterpret_cast<std::uintptr_t>(Contents.data()) % alignof(std::uint64_t) != 0)
+    return false;
+
+  const Header &Head = *reinterpret_cast<const Header *>(Contents.data());
+  if (Head.Magic != SnapshotMagic || Head.Version != SnapshotVersion || Head.TotalSize != Contents.size())
+    return false;
+
+  // The arrays have to lie inside the file, in the order they are written
+  const std::size_t U32 = sizeof(std::uint32_t);
+  const std::pair<std::size_t, std::size_t> Arrays[] = {
+    {Head.SectionsOffset, std::size_t(Head.SectionCount) * sizeof(SectionRecord)},
+    {Head.EntriesOffset, std::size_t(Head.EntryCount) * sizeof(EntryRecord)},
+    {Head.ValuesOffset, std::size_t(Head.ValueCount) * sizeof(ValueRecord)},
+    {Head.SectionDisplacementsOffset, std::size_t(Head.SectionBuckets) * U32},
+    {Head.SectionOrderOffset, std::size_t(Head.SectionCount) * U32},
+    {Head.EntryDisplacementsOffset, std::size_t(Head.EntryBuckets) * U32},
+    {Head.EntryOrderOffset, std::size_t(Head.EntryCount) * U32},
+    {Head.TextOffset, Head.TextSize}};
+
+  std::size_t End = sizeof(Header);
+  for (const auto &Array : Arrays)
+  {
+    if (Array.first < End || Array.first % 8 != 0)
+      return false;
+    End = Array.first + Array.second;
+  }
+
+  if (End > Head.TotalSize || Head.SectionBuckets != BucketCountFor(Head.SectionCount) || Head.EntryBuckets != BucketCountFor(Head.EntryCount))
+    return false;
+
+  // Every offset, count and index a lookup or an iteration follows has to stay
+  // inside the buffer. Displacements need no check, SlotOf reduces any value
+  // to a valid slot.
+  const char *Base = Contents.data();
+  auto        InText = [&Head](std::uint32_t Offset, std::uint32_t Length) { return std::uint64_t(Offset) + Length <= Head.TextSize; };
+
+  const auto *Sections = reinterpret_cast<const SectionRecord *>(Base + Head.SectionsOffset);
+  for (std::uint32_t s = 0; s < Head.SectionCount; ++s)
+    if (!InText(Sections[s].NameOffset, Sections[s].NameLength) || std::uint64_t(Sections[s].FirstEntry) + Sections[s].EntryCount > Head.EntryCount)
+      return false;
+
+  const auto *Entries = reinterpret_cast<const EntryRecord *>(Base + Head.EntriesOffset);
+  for (std::uint32_t e = 0; e < Head.EntryCount; ++e)
+    if (Entries[e].Section >= Head.SectionCount || !InText(Entries[e].KeyOffset, Entries[e].KeyLength) || std::uint64_t(Entries[e].FirstValue) + Entries[e].ValueCount > Head.ValueCount)
+      return false;
+
+  const auto *Values = reinterpret_cast<const ValueRecord *>(Base + Head.ValuesOffset);
+  for (std::uint32_t v = 0; v < Head.ValueCount; ++v)
+    if (!InText(Values[v].Offset, Values[v].Length))
+      return false;
+
+  const auto *SectionOrder = reinterpret_cast<const std::uint32_t *>(Base + Head.SectionOrderOffset);
+  for (std::uint32_t s = 0; s < Head.SectionCount; ++s)
+    if (SectionOrder[s] >= Head.SectionCount)
+      return false;
+
+  const auto *EntryOrder = reinterpret_cast<const std::uint32_t *>(Base + Head.EntryOrderOffset);
+  for (std::uint32_t e = 0; e < Head.EntryCount; ++e)
+    if (EntryOrder[e] >= Head.EntryCount)
+      return false;
+
+  m_Snapshot = std::move(Snapshot);
+  m_Header = reinterpret_cast<const Header *>(m_Snapshot.GetView().data());
+  return true;
+}
+
+bool FrozenIni::IsMapped() const
+{
+  return m_Snapshot.IsMapped();
+}
+
+const FrozenIni::Header *FrozenIni::GetEmptyHeader()
+{
+  static const Header Empty{};
+  return &Empty;
+}
+
+std::optional<std::uint32_t> FrozenIni::FindSection(std::string_view SectionName, std::uint64_t Hash) const
+{
+  if (m_Header->SectionCount == 0)
+    return std::nullopt;
+
+  const std::uint32_t  Displacement = GetArray<std::uint32_t>(m_Header->SectionDisplacementsOffset)[BucketOf(Hash, m_Header->SectionBuckets)];
+  const std::uint32_t  Index = SlotOf(Hash, Displacement, m_Header->SectionCount);
+  const SectionRecord &Section = GetArray<SectionRecord>(m_Header->SectionsOffset)[Index];
+
+  if (Section.Hash != Hash || GetText(Section.NameOffset, Section.NameLength) != SectionName)
+    return std::nullopt;
+
+  return Index;
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::FindEntry(std::string_view SectionName, std::string_view Key, std::uint64_t SectionHash, std::uint64_t KeyHash) const
+{
+  const std::uint64_t Hash = CombineHash(SectionHash, KeyHash);
+
+  const auto Index = FindEntryCandidate(Hash, Key);
+  if (!Index)
+    return std::nullopt;
+
+  const SectionRecord &Section = GetArray<SectionRecord>(m_Header->SectionsOffset)[GetArray<EntryRecord>(m_Header->EntriesOffset)[*Index].Section];
+  if (Section.Hash != SectionHash || GetText(Section.NameOffset, Section.NameLength) != SectionName)
+    return std::nullopt;
+
+  return EntryView(*this, *Index);
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::FindEntry(std::uint32_t Section, std::string_view Key, std::uint64_t KeyHash) const
+{
+  const std::uint64_t Hash = CombineHash(GetArray<SectionRecord>(m_Header->SectionsOffset)[Section].Hash, KeyHash);
+
+  const auto Index = FindEntryCandidate(Hash, Key);
+  if (!Index || GetArray<EntryRecord>(m_Header->EntriesOffset)[*Index].Section != Section)
+    return std::nullopt;
+
+  return EntryView(*this, *Index);
+}
+
+// The one entry the Section.Key hash can belong to, if its key matches
+std::optional<std::uint32_t> FrozenIni::FindEntryCandidate(std::uint64_t Hash, std::string_view Key) const
+{
+  if (m_Header->EntryCount == 0)
+    return std::nullopt;
+
+  const std::uint32_t Displacement = GetArray<std::uint32_t>(m_Header->EntryDisplacementsOffset)[BucketOf(Hash, m_Header->EntryBuckets)];
+  const std::uint32_t Index = SlotOf(Hash, Displacement, m_Header->EntryCount);
+  const EntryRecord & Entry = GetArray<EntryRecord>(m_Header->EntriesOffset)[Index];
+
+  if (Entry.Hash != Hash || GetText(Entry.KeyOffset, Entry.KeyLength) != Key)
+    return std::nullopt;
+
+  return Index;
+}
+
+std::string_view FrozenIni::GetText(std::uint32_t Offset, std::uint32_t Length) const
+{
+  return std::string_view(GetArray<char>(m_Header->TextOffset) + Offset, Length);
+}
+
+std::string_view FrozenIni::SectionView::GetName() const
+{
+  const SectionRecord &Section = m_File->GetArray<SectionRecord>(m_File->m_Header->SectionsOffset)[m_Index];
+  return m_File->GetText(Section.NameOffset, Section.NameLength);
+}
+
+std::size_t FrozenIni::SectionView::GetNumEntries() const
+{
+  return m_File->GetArray<SectionRecord>(m_File->m_Header->SectionsOffset)[m_Index].EntryCount;
+}
+
+bool FrozenIni::SectionView::HasEntry(std::string_view Key) const
+{
+  return m_File->FindEntry(m_Index, Key, HashName(Key)).has_value();
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::SectionView::TryGetEntry(std::string_view Key) const
+{
+  return m_File->FindEntry(m_Index, Key, HashName(Key));
+}
+
+std::optional<FrozenIni::EntryView> FrozenIni::SectionView::TryGetEntry(const IniHashedName &Key) const
+{
+  return m_File->FindEntry(m_Index, Key.Name, Key.Hash);
+}
+
+FrozenIni::SectionView::const_iterator FrozenIni::SectionView::begin() const
+{
+  return const_iterator(*m_File, m_File->GetArray<SectionRecord>(m_File->m_Header->SectionsOffset)[m_Index].FirstEntry);
+}
+
+FrozenIni::SectionView::const_iterator FrozenIni::SectionView::end() const
+{
+  const SectionRecord &Section = m_File->GetArray<SectionRecord>(m_File->m_Header->SectionsOffset)[m_Index];
+  return const_iterator(*m_File, Section.FirstEntry + Section.EntryCount);
+}
+
+FrozenIni::EntryView FrozenIni::SectionView::const_iterator::operator*() const
+{
+  return EntryView(*m_File, m_File->GetArray<std::uint32_t>(m_File->m_Header->EntryOrderOffset)[m_Index]);
+}
+
+std::string_view FrozenIni::EntryView::GetKey() const
+{
+  const EntryRecord &Entry = m_File->GetArray<EntryRecord>(m_File->m_Header->EntriesOffset)[m_Index];
+  return m_File->GetText(Entry.KeyOffset, Entry.KeyLength);
+}
+
+std::string_view FrozenIni::EntryView::GetSectionName() const
+{
+  return SectionView(*m_File, m_File->GetArray<EntryRecord>(m_File->m_Header->EntriesOffset)[m_Index].Section).GetName();
+}
+
+std::size_t FrozenIni::EntryView::GetValueCount() const
+{
+  return m_File->GetArray<EntryRecord>(m_File->m_Header->EntriesOffset)[m_Index].ValueCount;
+}
+
+std::optional<std::string> FrozenIni::EntryView::TryGetValue() const
+{
+  return (*this)[0];
+}
+
+std::optional<std::string> FrozenIni::EntryView::operator[](std::size_t ValIndex) const
+{
+  const std::optional<std::string_view> Value = GetValueView(ValIndex);
+  if (!Value)
+    return std::nullopt;
+
+  return std::string(*Value);
+}
+
+std::optional<std::string_view> FrozenIni::EntryView::TryGetValueView() const
+{
+  return GetValueView(0);
+}
+
+std::optional<std::string_view> FrozenIni::EntryView::GetValueView(std::size_t ValIndex) const
+{
+  const EntryRecord &Entry = m_File->GetArray<EntryRecord>(m_File->m_Header->EntriesOffset)[m_Index];
+  if (ValIndex >= Entry.ValueCount)
+    return std::nullopt;
+
+  const ValueRecord &Value = m_File->GetArray<ValueRecord>(m_File->m_Header->ValuesOffset)[Entry.FirstValue + ValIndex];
+  return m_File->GetText(Value.Offset, Value.Length);
+}
+
+std::optional<std::int64_t> FrozenIni::EntryView::GetInt(std::size_t ValIndex) const
+{
+  return GetAs<std::int64_t>(ValIndex);
+}
+
+std::optional<double> FrozenIni::EntryView::GetDouble(std::size_t ValIndex) const
+{
+  return GetAs<double>(ValIndex);
+}
+
+std::optional<bool> FrozenIni::EntryView::GetBool(std::size_t ValIndex) const
+{
+  return GetAs<bool>(ValIndex);
+}
@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniConvert.h"
+#include "IniFile.h"
+#include "IniMappedFile.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Immutable, compiled form of an IniFile, see IniFile::Freeze
+//
+// Everything lives in one contiguous buffer: a header, fixed size records for
+// sections, entries and values, the tables of two minimal perfect hashes (one
+// over section names, one over Section.Key pairs) and all names, keys and
+// values packed back to back. Records refer to each other and to the text by
+// offset only.
+//
+// A lookup computes one slot from the hash, checks the single record stored
+// there and compares its strings, so there is no probing and nothing
+// allocates. Nothing is ever written after construction, so any number of
+// threads can read a FrozenIni at once.
+//
+// Since the buffer holds no pointers it is also the snapshot file format:
+// WriteSnapshot saves it as is and OpenSnapshot maps it back and reads it in
+// place. Opening allocates nothing and builds nothing, it only walks the
+// records once to check that every offset, count and index stays inside the
+// file, so a damaged or hand-made snapshot is refused rather than read out of
+// bounds.
+//
+// The views answer the same calls as IniSection and IniEntry, and get()
+// returns the view itself, so lookups written against IniFile's
+// std::reference_wrapper results, like
+//   File.TryGetSection("Server")->get().TryGetEntry("Port")->get().GetInt()
+// compile unchanged against a FrozenIni.
+class FrozenIni
+{
+  struct Header;
+  struct SectionRecord;
+  struct EntryRecord;
+  struct ValueRecord;
+
+public:
+  class EntryView
+  {
+  public:
+    std::string_view                GetKey() const;
+    std::string_view                GetSectionName() const;
+    std::size_t                     GetValueCount() const;
+    std::optional<std::string>      TryGetValue() const;
+    std::optional<std::string>      operator[](std::size_t ValIndex) const;
+    std::optional<std::string_view> TryGetValueView() const;
+    std::optional<std::string_view> GetValueView(std::size_t ValIndex) const;
+    std::optional<std::int64_t>     GetInt(std::size_t ValIndex = 0) const;
+    std::optional<double>           GetDouble(std::size_t ValIndex = 0) const;
+    std::optional<bool>             GetBool(std::size_t ValIndex = 0) const;
+
+    template<class T>
+    std::optional<T> GetAs(std::size_t ValIndex = 0) const
+    {
+      T                                     Value{};
+      const std::optional<std::string_view> Text = GetValueView(ValIndex);
+      if (!Text || !IniConvert::Parse(*Text, Value))
+        return std::nullopt;
+
+      return Value;
+    }
+
+    const EntryView &get() const
+    {
+      return *this;
+    }
+
+  private:
+    friend class FrozenIni;
+
+    EntryView(const FrozenIni &File, std::uint32_t Index)
+        : m_File(&File)
+        , m_Index(Index)
+    {}
+
+    const FrozenIni *m_File;
+    std::uint32_t    m_Index;
+  };
+
+  class SectionView
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      EntryView operator*() const;
+
+      const_iterator &operator++()
+      {
+        ++m_Index;
+        return *this;
+      }
+
+      bool operator==(const const_iterator &Other) const
+      {
+        return m_Index == Other.m_Index;
+      }
+
+      bool operator!=(const const_iterator &Other) const
+      {
+        return m_Index != Other.m_Index;
+      }
+
+    private:
+      friend class SectionView;
+
+      const_iterator(const FrozenIni &File, std::uint32_t Index)
+          : m_File(&File)
+          , m_Index(Index)
+      {}
+
+      const FrozenIni *m_File;
+      std::uint32_t    m_Index;
+    };
+
+    std::string_view         GetName() const;
+    std::size_t              GetNumEntries() const;
+    bool                     HasEntry(std::string_view Key) const;
+    std::optional<EntryView> TryGetEntry(std::string_view Key) const;
+    std::optional<EntryView> TryGetEntry(const IniHashedName &Key) const;
+    const_iterator           begin() const;
+    const_iterator           end() const;
+
+    const SectionView &get() const
+    {
+      return *this;
+    }
+
+  private:
+    friend class FrozenIni;
+
+    SectionView(const FrozenIni &File, std::uint32_t Index)
+        : m_File(&File)
+        , m_Index(Index)
+    {}
+
+    const FrozenIni *m_File;
+    std::uint32_t    m_Index;
+  };
+
+  FrozenIni();
+  explicit FrozenIni(const IniFile &File);
+  FrozenIni(const FrozenIni &) = delete;
+  FrozenIni(FrozenIni &&Other) noexcept;
+
+  FrozenIni &operator=(const FrozenIni &) = delete;
+  FrozenIni &operator=(FrozenIni &&Other) noexcept;
+
+  bool                       HasSection(std::string_view SectionName) const;
+  std::optional<SectionView> TryGetSection(std::string_view SectionName) const;
+  std::optional<SectionView> TryGetSection(const IniHashedName &SectionName) const;
+  std::optional<EntryView>   TryGetEntry(std::string_view SectionName, std::string_view Key) const;
+  std::optional<EntryView>   TryGetEntry(const IniKey &Key) const;
+  std::size_t                GetNumSections() const;
+  std::size_t                GetNumEntries() const;
+  SectionView                GetSection(std::size_t Index) const;
+
+  // Size of the buffer holding everything, which is also the snapshot size
+  std::size_t GetMemoryUsage() const;
+
+  // Snapshot files, see above. OpenSnapshot leaves the FrozenIni empty and
+  // returns false for a file that is not a snapshot of this version.
+  bool WriteSnapshot(const std::string &FileName) const;
+  bool OpenSnapshot(const std::string &FileName, IniReadMode ReadMode = IniReadMode::Mapped);
+  bool IsMapped() const;
+
+private:
+  std::optional<std::uint32_t> FindSection(std::string_view SectionName, std::uint64_t Hash) const;
+  std::optional<EntryView>     FindEntry(std::string_view SectionName, std::string_view Key, std::uint64_t SectionHash, std::uint64_t KeyHash) const;
+  std::optional<EntryView>     FindEntry(std::uint32_t Section, std::string_view Key, std::uint64_t KeyHash) const;
+  std::optional<std::uint32_t> FindEntryCandidate(std::uint64_t Hash, std::string_view Key) const;
+  static const Header *        GetEmptyHeader();
+  std::string_view             GetText(std::uint32_t Offset, std::uint32_t Length) const;
+
+  template<class T>
+  const T *GetArray(std::uint32_t Offset) const
+  {
+    return reinterpret_cast<const T *>(reinterpret_cast<const char *>(m_Header) + Offset);
+  }
+
+  std::vector<std::uint64_t> m_Storage;  // when built from an IniFile
+  IniMappedFile              m_Snapshot;  // when opened from a snapshot
+  const Header *             m_Header;
+};
@@ -0,0 +1,395 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// Cache file layout, native byte order (the magic doubles as a byte order
+// check):
+//
+//   CacheHeader
+//   per section:  u32 name length, name, u64 source begin, u64 source end,
+//                 u64 source hash, u32 entry count
+//     per entry:  u32 key length, key, u32 value count
+//       per value: u32 value length, value
+//
+// Sections and entries are stored in IniFile order, so a loaded file iterates
+// the same way as a parsed one. The source ranges are where each section sits
+// in the source file (see SaveIncremental), and are only used when the
+// header's HasSourceRanges says they describe the stamped file.
+namespace
+{
+  constexpr std::uint64_t CacheMagic = 0x4548434143494E49ull;  // "INICACHE"
+  constexpr std::uint64_t CacheVersion = 2;  // 2: source ranges added
+
+  struct CacheHeader
+  {
+    std::uint64_t Magic;
+    std::uint64_t Version;
+    std::uint64_t SourceSize;
+    std::int64_t  SourceModified;
+    std::uint64_t SourceHash;
+    std::uint64_t SectionCount;
+    std::uint64_t PayloadSize;
+    std::uint64_t HasSourceRanges;
+  };
+
+  // Everything about the source file the cache has to agree with
+  struct SourceStamp
+  {
+    std::uint64_t Size = 0;
+    std::int64_t  Modified = 0;
+  };
+
+  bool GetSourceStamp(const std::string &FileName, SourceStamp &Stamp)
+  {
+    std::error_code Error;
+
+    const auto Size = std::filesystem::file_size(FileName, Error);
+    if (Error)
+      return false;
+
+    const auto Modified = std::filesystem::last_write_time(FileName, Error);
+    if (Error)
+      return false;
+
+    Stamp.Size = static_cast<std::uint64_t>(Size);
+    Stamp.Modified = static_cast<std::int64_t>(Modified.time_since_epoch().count());
+    return true;
+  }
+
+  void PutU32(std::string &Out, std::size_t Value)
+  {
+    const auto Word = static_cast<std::uint32_t>(Value);
+    Out.append(reinterpret_cast<const char *>(&Word), sizeof(Word));
+  }
+
+  void PutU64(std::string &Out, std::uint64_t Value)
+  {
+    Out.append(reinterpret_cast<const char *>(&Value), sizeof(Value));
+  }
+
+  void PutString(std::string &Out, std::string_view Str)
+  {
+    PutU32(Out, Str.size());
+    Out.append(Str.data(), Str.size());
+  }
+
+  // Bounds checked reads from the payload, every read fails once one has
+  struct PayloadReader
+  {
+    std::string_view Payload;
+    std::size_t      Position = 0;
+    bool             Failed = false;
+
+    template<class T>
+    T Get()
+    {
+      T Word = 0;
+      if (Failed || Payload.size() - Position < sizeof(Word))
+      {
+        Failed = true;
+        return 0;
+      }
+
+      std::memcpy(&Word, Payload.data() + Position, sizeof(Word));
+      Position += sizeof(Word);
+      return Word;
+    }
+
+    std::uint32_t GetU32()
+    {
+      return Get<std::uint32_t>();
+    }
+
+    std::uint64_t GetU64()
+    {
+      return Get<std::uint64_t>();
+    }
+
+    std::string_view GetString()
+    {
+      const std::uint32_t Length = GetU32();
+      if (Failed || Payload.size() - Position < Length)
+      {
+        Failed = true;
+        return {};
+      }
+
+      const std::string_view Str = Payload.substr(Position, Length);
+      Position += Length;
+      return Str;
+    }
+  };
+
+  constexpr std::uint64_t NoRange = static_cast<std::uint64_t>(-1);
+
+  // Walks the whole payload without building anything, so a truncated or
+  // damaged cache is refused before the file is touched. Source ranges that
+  // are used have to lie inside the source without overlapping, as
+  // SaveIncremental copies the bytes between them.
+  bool IsWellFormed(std::string_view Payload, const CacheHeader &Header)
+  {
+    PayloadReader                                        Reader{Payload};
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> Ranges;
+
+    for (std::uint64_t s = 0; s < Header.SectionCount && !Reader.Failed; ++s)
+    {
+      Reader.GetString();
+      const std::uint64_t Begin = Reader.GetU64();
+      const std::uint64_t End = Reader.GetU64();
+      Reader.GetU64();
+      const std::uint32_t EntryCount = Reader.GetU32();
+
+      if (Header.HasSourceRanges && Begin != NoRange)
+        Ranges.emplace_back(Begin, End);
+
+      for (std::uint32_t e = 0; e < EntryCount && !Reader.Failed; ++e)
+      {
+        Reader.GetString();
+        const std::uint32_t ValueCount = Reader.GetU32();
+
+        for (std::uint32_t v = 0; v < ValueCount && !Reader.Failed; ++v)
+          Reader.GetString();
+      }
+    }
+
+    if (Reader.Failed || Reader.Position != Payload.size())
+      return false;
+
+    std::sort(Ranges.begin(), Ranges.end());
+
+    std::uint64_t Covered = 0;
+    for (const auto &Range : Ranges)
+    {
+      if (Range.first < Covered || Range.second < Range.first || Range.second > Header.SourceSize)
+        return false;
+      Covered = Range.second;
+    }
+
+    return true;
+  }
+}  // namespace
+
+bool IniFile::WriteCacheFile(const std::string &CacheFileName, std::uint64_t SourceSize, std::int64_t SourceModified, std::uint64_t SourceHash, bool HasSourceRanges) const
+{
+  std::string Out(sizeof(CacheHeader), '\0');
+  for (auto SectionIt = m_Sections.cbegin(); SectionIt != m_Sections.cend(); ++SectionIt)
+  {
+    const IniSection &Section = SectionIt->second;
+
+    PutString(Out, SectionIt->first);
+    PutU64(Out, HasSourceRanges && Section.m_Source.Begin != IniSection::SourceRange::None ? Section.m_Source.Begin : NoRange);
+    PutU64(Out, HasSourceRanges && Section.m_Source.End != IniSection::SourceRange::None ? Section.m_Source.End : NoRange);
+    PutU64(Out, Section.m_Source.Hash);
+    PutU32(Out, Section.GetNumEntries());
+
+    for (auto EntryIt = Section.cbegin(); EntryIt != Section.cend(); ++EntryIt)
+    {
+      const IniEntry &Entry = EntryIt->second;
+
+      PutString(Out, EntryIt->first);
+      PutU32(Out, Entry.GetValueCount());
+
+      for (std::size_t v = 0; v < Entry.GetValueCount(); ++v)
+        PutString(Out, *Entry.GetValueView(v));
+    }
+  }
+
+  CacheHeader Header{};
+  Header.Magic = CacheMagic;
+  Header.Version = CacheVersion;
+  Header.SourceSize = SourceSize;
+  Header.SourceModified = SourceModified;
+  Header.SourceHash = SourceHash;
+  Header.SectionCount = m_Sections.size();
+  Header.PayloadSize = Out.size() - sizeof(CacheHeader);
+  Header.HasSourceRanges = HasSourceRanges;
+  std::memcpy(&Out[0], &Header, sizeof(Header));
+
+  // Renamed over the cache, so a process reading it at the same time never
+  // sees half of it
+  return IniReplaceFile(CacheFileName, Out);
+}
+
+bool IniFile::WriteCache(const std::string &SourceFileName, const std::string &CacheFileName) const
+{
+  SourceStamp Stamp;
+  if (!GetSourceStamp(SourceFileName, Stamp))
+    return false;
+
+  IniMappedFile Source;
+  if (!Source.Open(SourceFileName, IniReadMode::Buffered))
+    return false;
+
+  // The sections' source ranges only describe SourceFileName when it is this
+  // file's source, unchanged since it was read or saved
+  const bool HasSourceRanges = !IsDirty() && m_Source.FileName == SourceFileName && m_Source.Size == Stamp.Size && m_Source.Modified == Stamp.Modified;
+
+  return WriteCacheFile(CacheFileName, Stamp.Size, Stamp.Modified, IniHashString(Source.GetView()), HasSourceRanges);
+}
+
+bool IniFile::ReadCache(const std::string &SourceFileName, const std::string &CacheFileName)
+{
+  SourceStamp Stamp;
+  if (!GetSourceStamp(SourceFileName, Stamp))
+    return false;
+
+  IniMappedFile Cache;
+  if (!Cache.Open(CacheFileName, IniReadMode::MappedSequential))
+    return false;
+
+  const std::string_view Contents = Cache.GetView();
+  if (Contents.size() < sizeof(CacheHeader))
+    return false;
+
+  CacheHeader Header;
+  std::memcpy(&Header, Contents.data(), sizeof(Header));
+
+  if (Header.Magic != CacheMagic || Header.Version != CacheVersion || Header.SourceSize != Stamp.Size || Header.SourceModified != Stamp.Modified)
+    return false;
+
+  const std::string_view Payload = Contents.substr(sizeof(CacheHeader));
+  if (Header.PayloadSize != Payload.size() || !IsWellFormed(Payload, Header))
+    return false;
+
+  // Size and time agree, the content hash catches edits that kept both. Read
+  // rather than mapped, a file truncated in place while mapped faults.
+  {
+    IniMappedFile Source;
+    if (!Source.Open(SourceFileName, IniReadMode::Buffered) || IniHashString(Source.GetView()) != Header.SourceHash)
+      return false;
+  }
+
+  // Loaded into an empty IniFile the cache leaves the same state as ReadFile:
+  // everything clean and, when the cache knows where the sections are, the
+  // file as the source SaveIncremental splices into
+  const bool IsSource = m_Sections.empty();
+  m_Sections.reserve(m_Sections.size() + static_cast<std::size_t>(Header.SectionCount));
+
+  PayloadReader Reader{Payload};
+  for (std::uint64_t s = 0; s < Header.SectionCount; ++s)
+  {
+    const std::string_view Name = Reader.GetString();
+    const std::uint64_t    Begin = Reader.GetU64();
+    const std::uint64_t    End = Reader.GetU64();
+    const std::uint64_t    Hash = Reader.GetU64();
+    const std::uint32_t    EntryCount = Reader.GetU32();
+
+    // The first block for a section wins, same as the parser
+    auto        Res = m_Sections.try_emplace(Name, Name);
+    IniSection *Section = Res.second ? &Res.first->second : nullptr;
+    if (Section)
+    {
+      Section->m_Entries.reserve(EntryCount);
+      if (IsSource && Header.HasSourceRanges && Begin != NoRange)
+        Section->m_Source = {static_cast<std::size_t>(Begin), static_cast<std::size_t>(End), Hash};
+    }
+
+    for (std::uint32_t e = 0; e < EntryCount; ++e)
+    {
+      const std::string_view Key = Reader.GetString();
+      const std::uint32_t    ValueCount = Reader.GetU32();
+      IniEntry *             Entry = Section ? &Section->m_Entries.try_emplace(Key, Key).first->second : nullptr;
+
+      for (std::uint32_t v = 0; v < ValueCount; ++v)
+      {
+        const std::string_view Value = Reader.GetString();
+        if (Entry)
+          Entry->AddValue(Value);
+      }
+    }
+  }
+
+  if (IsSource)
+  {
+    m_Source = SourceFile();
+    if (Header.HasSourceRanges)
+    {
+      m_Source.FileName = SourceFileName;
+      m_Source.Size = static_cast<std::size_t>(Stamp.Size);
+      m_Source.Modified = Stamp.Modified;
+    }
+
+    ClearDirty();
+  }
+
+  return true;
+}
+
+bool IniFile::ReadFileCached(const std::string &FileName, const std::string &CacheFileName)
+{
+  if (ReadCache(FileName, CacheFileName))
+    return true;
+
+  // Stamped before the file is read, so an edit that lands after this moves
+  // the modification time past the stamp
+  SourceStamp Stamp;
+  if (!GetSourceStamp(FileName, Stamp))
+    return false;
+
+  // Read into memory once, the parse and the content hash see the same bytes
+  // even if the file is rewritten meanwhile
+  IniMappedFile Source;
+  if (!Source.Open(FileName, IniReadMode::Buffered))
+    return false;
+
+  const std::string_view Text = Source.GetView();
+  const bool             IsSource = m_Sections.empty() && m_ParseMode == IniParseMode::Scanner;
+  if (m_ParseMode == IniParseMode::Regex)
+  {
+    std::istringstream In{std::string(Text)};
+    if (!ParseFile(In))
+      return false;
+  }
+  else
+  {
+    ReadSource(FileName, Text);
+  }
+
+  // The source ranges describe Text, so the source is stamped as it was
+  // before Text was read, not as it is after the parse
+  if (IsSource)
+  {
+    m_Source.Size = static_cast<std::size_t>(Stamp.Size);
+    m_Source.Modified = Stamp.Modified;
+  }
+
+  // A cache that cannot be written only costs the next startup a parse
+  WriteCacheFile(CacheFileName, Stamp.Size, Stamp.Modified, IniHashString(Text), IsSource);
+  return true;
+}
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+// Value conversions used by IniEntry's typed getters
+//
+// Built on std::from_chars, so nothing allocates and the result does not
+// depend on the global locale. Surrounding spaces and tabs are ignored, but
+// the rest of the value has to be consumed: "42" and " 42 " are ints, "42ms"
+// and "4 2" are not.
+namespace IniConvert
+{
+  inline std::string_view Trim(std::string_view Text)
+  {
+    auto IsSpace = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+
+    while (!Text.empty() && IsSpace(Text.front()))
+      Text.remove_prefix(1);
+    while (!Text.empty() && IsSpace(Text.back()))
+      Text.remove_suffix(1);
+
+    return Text;
+  }
+
+  // "true"/"false", "yes"/"no", "on"/"off" in any case, or "1"/"0"
+  inline bool ParseBool(std::string_view Text, bool &Out)
+  {
+    Text = Trim(Text);
+
+    auto Equals = [&Text](std::string_view Word) {
+      if (Text.size() != Word.size())
+        return false;
+
+      for (std::size_t i = 0; i < Word.size(); ++i)
+      {
+        if ((Text[i] | 0x20) != Word[i])
+          return false;
+      }
+
+      return true;
+    };
+
+    if (Text == "1" || Equals("true") || Equals("yes") || Equals("on"))
+    {
+      Out = true;
+      return true;
+    }
+
+    if (Text == "0" || Equals("false") || Equals("no") || Equals("off"))
+    {
+      Out = false;
+      return true;
+    }
+
+    return false;
+  }
+
+  // Integers and floating point values, a leading '+' is accepted
+  template<class T>
+  bool ParseNumber(std::string_view Text, T &Out)
+  {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "ParseNumber converts to integer and floating point types");
+
+    Text = Trim(Text);
+    if (Text.size() > 1 && Text.front() == '+' && Text[1] != '-')
+      Text.remove_prefix(1);
+
+    const char *const End = Text.data() + Text.size();
+
+    T Value{};
+    const std::from_chars_result Result = std::from_chars(Text.data(), End, Value);
+    if (Result.ec != std::errc() || Result.ptr != End)
+      return false;
+
+    Out = Value;
+    return true;
+  }
+
+  template<class T>
+  bool Parse(std::string_view Text, T &Out)
+  {
+    if constexpr (std::is_same<T, bool>::value)
+    {
+      return ParseBool(Text, Out);
+    }
+    else if constexpr (std::is_same<T, std::string_view>::value)
+    {
+      Out = Trim(Text);
+      return true;
+    }
+    else
+    {
+      return ParseNumber(Text, Out);
+    }
+  }
+}  // namespace IniConvert
@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniDiff.h"
+
+namespace
+{
+  using Change = IniDiff::Change;
+
+  IniDiff::EntryChange WholeEntry(const IniEntry &Entry, Change Kind)
+  {
+    IniDiff::EntryChange Changed{Kind, std::string(Entry.GetKey()), {}};
+    Changed.Values.reserve(Entry.GetValueCount());
+
+    std::size_t Index = 0;
+    for (const std::pmr::string &Value : Entry.GetValues())
+    {
+      if (Kind == Change::Added)
+        Changed.Values.push_back({Kind, Index++, std::string(), std::string(Value)});
+      else
+        Changed.Values.push_back({Kind, Index++, std::string(Value), std::string()});
+    }
+
+    return Changed;
+  }
+
+  IniDiff::SectionChange WholeSection(const IniSection &Section, Change Kind)
+  {
+    IniDiff::SectionChange Changed{Kind, std::string(Section.GetName()), {}};
+    Changed.Entries.reserve(Section.GetNumEntries());
+
+    for (auto it = Section.cbegin(); it != Section.cend(); ++it)
+      Changed.Entries.push_back(WholeEntry(it->second, Kind));
+
+    return Changed;
+  }
+
+  // Values are compared by position, so inserting a value into the middle of
+  // a list modifies every value after it
+  std::vector<IniDiff::ValueChange> CompareValues(const IniEntry &Old, const IniEntry &New)
+  {
+    const IniEntry::value_list_t &OldValues = Old.GetValues();
+    const IniEntry::value_list_t &NewValues = New.GetValues();
+
+    std::vector<IniDiff::ValueChange> Changes;
+    for (std::size_t i = 0; i < OldValues.size() || i < NewValues.size(); ++i)
+    {
+      if (i >= OldValues.size())
+        Changes.push_back({Change::Added, i, std::string(), std::string(NewValues[i])});
+      else if (i >= NewValues.size())
+        Changes.push_back({Change::Removed, i, std::string(OldValues[i]), std::string()});
+      else if (OldValues[i] != NewValues[i])
+        Changes.push_back({Change::Modified, i, std::string(OldValues[i]), std::string(NewValues[i])});
+    }
+
+    return Changes;
+  }
+}  // namespace
+
+IniDiff::IniDiff(const IniFile &Old, const IniFile &New)
+{
+  for (auto NewIt = New.m_Sections.cbegin(); NewIt != New.m_Sections.cend(); ++NewIt)
+  {
+    const IniSection &NewSection = NewIt->second;
+
+    auto OldIt = Old.m_Sections.find(NewIt->first);
+    if (OldIt == Old.m_Sections.cend())
+    {
+      m_Sections.push_back(WholeSection(NewSection, Change::Added));
+      continue;
+    }
+
+    const IniSection &OldSection = OldIt->second;
+    if (OldSection.GetContentHash() == NewSection.GetContentHash())
+      continue;
+
+    SectionChange Changed{Change::Modified, std::string(NewSection.GetName()), {}};
+
+    for (auto EntryIt = NewSection.m_Entries.cbegin(); EntryIt != NewSection.m_Entries.cend(); ++EntryIt)
+    {
+      auto OldEntryIt = OldSection.m_Entries.find(EntryIt->first);
+      if (OldEntryIt == OldSection.m_Entries.cend())
+      {
+        Changed.Entries.push_back(WholeEntry(EntryIt->second, Change::Added));
+        continue;
+      }
+
+      std::vector<ValueChange> Values = CompareValues(OldEntryIt->second, EntryIt->second);
+      if (!Values.empty())
+        Changed.Entries.push_back({Change::Modified, std::string(EntryIt->first), std::move(Values)});
+    }
+
+    for (auto EntryIt = OldSection.m_Entries.cbegin(); EntryIt != OldSection.m_Entries.cend(); ++EntryIt)
+    {
+      if (NewSection.m_Entries.find(EntryIt->first) == NewSection.m_Entries.cend())
+        Changed.Entries.push_back(WholeEntry(EntryIt->second, Change::Removed));
+    }
+
+    if (!Changed.Entries.empty())
+      m_Sections.push_back(std::move(Changed));
+  }
+
+  for (auto OldIt = Old.m_Sections.cbegin(); OldIt != Old.m_Sections.cend(); ++OldIt)
+  {
+    if (New.m_Sections.find(OldIt->first) == New.m_Sections.cend())
+      m_Sections.push_back(WholeSection(OldIt->second, Change::Removed));
+  }
+}
+
+std::size_t IniDiff::GetNumEntryChanges() const
+{
+  std::size_t Count = 0;
+  for (const SectionChange &Section : m_Sections)
+    Count += Section.Entries.size();
+
+  return Count;
+}
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// What changed from one version of an ini file to the next
+//
+// Sections are matched by name, entries by key and list values by position.
+// Sections with the same content hash (IniSection::GetContentHash) are
+// skipped without looking at their entries. A file read by ReadFile keeps its
+// hashes while it is not edited, so diffing each reload against the one
+// before only hashes the new file. A 64 bit hash collision would hide a
+// change, the same trade IniWatcher makes when it skips unchanged files.
+//
+// Names, keys and values are copied, the diff does not refer to either file.
+class IniDiff
+{
+public:
+  enum class Change : std::uint8_t
+  {
+    Added,
+    Removed,
+    Modified
+  };
+
+  // OldValue is empty for an added value, NewValue for a removed one
+  struct ValueChange
+  {
+    Change      Kind;
+    std::size_t Index;
+    std::string OldValue;
+    std::string NewValue;
+  };
+
+  // An added or removed entry lists all of its values as added or removed
+  struct EntryChange
+  {
+    Change                   Kind;
+    std::string              Key;
+    std::vector<ValueChange> Values;
+  };
+
+  // An added or removed section lists all of its entries the same way
+  struct SectionChange
+  {
+    Change                   Kind;
+    std::string              Name;
+    std::vector<EntryChange> Entries;
+  };
+
+  IniDiff() = default;
+  IniDiff(const IniFile &Old, const IniFile &New);
+
+  bool IsEmpty() const
+  {
+    return m_Sections.empty();
+  }
+
+  // Sections of New in its order, then the sections removed from Old
+  const std::vector<SectionChange> &GetSections() const
+  {
+    return m_Sections;
+  }
+
+  // Number of added, removed and modified entries over every section
+  std::size_t GetNumEntryChanges() const;
+
+private:
+  std::vector<SectionChange> m_Sections;
+};
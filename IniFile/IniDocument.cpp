@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniDocument.h"
+
+#include "IniScanner.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+  constexpr std::uint32_t NoSection = std::numeric_limits<std::uint32_t>::max();
+
+  struct PendingValue
+  {
+    std::uint32_t    Entry;
+    std::string_view Value;
+  };
+}  // namespace
+
+struct IniDocument::ScanHandler
+{
+  IniDocument &                                       Document;
+  std::vector<PendingValue>                           Pending;
+  std::unordered_map<std::string_view, std::uint32_t> SectionKeys;  // keys of the current section only
+  std::uint32_t                                       Section = NoSection;
+
+  void OnSection(std::string_view Name)
+  {
+    // The first block for a section wins, same as IniFile
+    const auto NextIndex = static_cast<std::uint32_t>(Document.m_Sections.size());
+    const auto Res = Document.m_SectionLookup.try_emplace(Name, NextIndex);
+
+    SectionKeys.clear();
+
+    if (!Res.second)
+    {
+      Section = NoSection;
+      return;
+    }
+
+    Document.m_Sections.push_back({Name, static_cast<std::uint32_t>(Document.m_Entries.size()), 0});
+    Section = NextIndex;
+  }
+
+  void OnEntry(std::string_view Key, std::string_view Value, bool)
+  {
+    if (Section == NoSection)
+      return;
+
+    const auto NextIndex = static_cast<std::uint32_t>(Document.m_Entries.size());
+    const auto Res = SectionKeys.try_emplace(Key, NextIndex);
+
+    if (Res.second)
+    {
+      Document.m_Entries.push_back({Key, 0, 0});
+      ++Document.m_Sections[Section].EntryCount;
+    }
+
+    ++Document.m_Entries[Res.first->second].ValueCount;
+    Pending.push_back({Res.first->second, Value});
+  }
+};
+
+bool IniDocument::ReadFile(const std::string &FileName, IniReadMode ReadMode)
+{
+  Clear();
+
+  if (!m_File.Open(FileName, ReadMode))
+    return false;
+
+  m_Text = m_File.GetView();
+  Index();
+  return true;
+}
+
+void IniDocument::ParseBuffer(std::string_view Buffer)
+{
+  Clear();
+
+  m_Buffer.assign(Buffer.begin(), Buffer.end());
+  m_Text = std::string_view(m_Buffer.data(), m_Buffer.size());
+  Index();
+}
+
+void IniDocument::Index()
+{
+  IniScanner  Scanner;
+  ScanHandler Handler{*this, {}, {}};
+  Scanner.Scan(m_Text, Handler);
+
+  // Values for one key can be scattered through a section ('+Key=' lines), so
+  // group them per entry with a counting sort that keeps their file order
+  std::uint32_t Offset = 0;
+  for (EntryRecord &Entry : m_Entries)
+  {
+    Entry.FirstValue = Offset;
+    Offset += Entry.ValueCount;
+    Entry.ValueCount = 0;
+  }
+
+  m_Values.resize(Handler.Pending.size());
+  for (const PendingValue &Pending : Handler.Pending)
+  {
+    EntryRecord &Entry = m_Entries[Pending.Entry];
+    m_Values[Entry.FirstValue + Entry.ValueCount++] = Pending.Value;
+  }
+
+  // Entries of a section are contiguous, so each section sorts its own range
+  m_SortedEntries.resize(m_Entries.size());
+  for (std::uint32_t i = 0; i < m_SortedEntries.size(); ++i)
+    m_SortedEntries[i] = i;
+
+  for (const SectionRecord &Section : m_Sections)
+  {
+    auto First = m_SortedEntries.begin() + Section.FirstEntry;
+    std::sort(First, First + Section.EntryCount, [this](std::uint32_t LHS, std::uint32_t RHS) { return m_Entries[LHS].Key < m_Entries[RHS].Key; });
+  }
+}
+
+std::optional<std::uint32_t> IniDocument::FindEntry(std::uint32_t Section, std::string_view Key) const
+{
+  const SectionRecord &Record = m_Sections[Section];
+
+  const auto First = m_SortedEntries.begin() + Record.FirstEntry;
+  const auto Last = First + Record.EntryCount;
+  const auto it = std::lower_bound(First, Last, Key, [this](std::uint32_t Index, std::string_view Key) { return m_Entries[Index].Key < Key; });
+
+  if (it == Last || m_Entries[*it].Key != Key)
+    return std::nullopt;
+
+  return *it;
+}
+
+bool IniDocument::HasSection(std::string_view SectionName) const
+{
+  return m_SectionLookup.find(SectionName) != m_SectionLookup.end();
+}
+
+std::optional<IniDocument::SectionView> IniDocument::TryGetSection(std::string_view SectionName) const
+{
+  auto it = m_SectionLookup.find(SectionName);
+  if (it == m_SectionLookup.end())
+    return std::nullopt;
+
+  return SectionView(*this, it->second);
+}
+
+std::size_t IniDocument::GetNumSections() const
+{
+  return m_Sections.size();
+}
+
+IniDocument::SectionView IniDocument::GetSection(std::size_t Index) const
+{
+  return SectionView(*this, static_cast<std::uint32_t>(Index));
+}
+
+std::string_view IniDocument::GetText() const
+{
+  return m_Text;
+}
+
+void IniDocument::Clear()
+{
+  m_Sections.clear();
+  m_Entries.clear();
+  m_Values.clear();
+  m_SortedEntries.clear();
+  m_SectionLookup.clear();
+  m_Text = std::string_view();
+  m_Buffer = std::vector<char>();
+  m_File.Close();
+}
+
+std::string_view IniDocument::SectionView::GetName() const
+{
+  return m_Document->m_Sections[m_Index].Name;
+}
+
+std::size_t IniDocument::SectionView::GetNumEntries() const
+{
+  return m_Document->m_Sections[m_Index].EntryCount;
+}
+
+bool IniDocument::SectionView::HasEntry(std::string_view Key) const
+{
+  return m_Document->FindEntry(m_Index, Key).has_value();
+}
+
+std::optional<IniDocument::EntryView> IniDocument::SectionView::TryGetEntry(std::string_view Key) const
+{
+  const auto Index = m_Document->FindEntry(m_Index, Key);
+  if (!Index)
+    return std::nullopt;
+
+  return EntryView(*m_Document, *Index);
+}
+
+IniDocument::SectionView::const_iterator IniDocument::SectionView::begin() const
+{
+  return const_iterator(*m_Document, m_Document->m_Sections[m_Index].FirstEntry);
+}
+
+IniDocument::SectionView::const_iterator IniDocument::SectionView::end() const
+{
+  const SectionRecord &Section = m_Document->m_Sections[m_Index];
+  return const_iterator(*m_Document, Section.FirstEntry + Section.EntryCount);
+}
+
+std::string_view IniDocument::EntryView::GetKey() const
+{
+  return m_Document->m_Entries[m_Index].Key;
+}
+
+std::size_t IniDocument::EntryView::GetValueCount() const
+{
+  return m_Document->m_Entries[m_Index].ValueCount;
+}
+
+std::optional<std::string_view> IniDocument::EntryView::TryGetValue() const
+{
+  return (*this)[0];
+}
+
+std::optional<std::string_view> IniDocument::EntryView::operator[](std::size_t ValIndex) const
+{
+  const EntryRecord &Entry = m_Document->m_Entries[m_Index];
+  if (ValIndex >= Entry.ValueCount)
+    return std::nullopt;
+
+  return m_Document->m_Values[Entry.FirstValue + ValIndex];
+}
+
+IniDocument::EntryView::value_const_iterator_t IniDocument::EntryView::begin() const
+{
+  return m_Document->m_Values.data() + m_Document->m_Entries[m_Index].FirstValue;
+}
+
+IniDocument::EntryView::value_const_iterator_t IniDocument::EntryView::end() const
+{
+  const EntryRecord &Entry = m_Document->m_Entries[m_Index];
+  return m_Document->m_Values.data() + Entry.FirstValue + Entry.ValueCount;
+}
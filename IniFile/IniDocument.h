@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniMappedFile.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Read-only, zero-copy view of a parsed ini file
+//
+// The document owns the raw text (a mapped file or one copy of a buffer) and
+// every section name, key and value it hands out is a std::string_view slice
+// of that text. Loading costs the buffer plus a flat index: one record per
+// section, per entry and per value, plus a per-section list of entries sorted
+// by key for lookups. Parsing follows the same grammar as
+// IniFile, so a document and an IniFile built from the same text agree.
+class IniDocument
+{
+  struct SectionRecord
+  {
+    std::string_view Name;
+    std::uint32_t    FirstEntry = 0;
+    std::uint32_t    EntryCount = 0;
+  };
+
+  struct EntryRecord
+  {
+    std::string_view Key;
+    std::uint32_t    FirstValue = 0;
+    std::uint32_t    ValueCount = 0;
+  };
+
+public:
+  class EntryView
+  {
+  public:
+    using value_const_iterator_t = const std::string_view *;
+
+    std::string_view                GetKey() const;
+    std::size_t                     GetValueCount() const;
+    std::optional<std::string_view> TryGetValue() const;
+    std::optional<std::string_view> operator[](std::size_t ValIndex) const;
+    value_const_iterator_t          begin() const;
+    value_const_iterator_t          end() const;
+
+  private:
+    friend class IniDocument;
+
+    EntryView(const IniDocument &Document, std::uint32_t Index)
+        : m_Document(&Document)
+        , m_Index(Index)
+    {}
+
+    const IniDocument *m_Document;
+    std::uint32_t      m_Index;
+  };
+
+  class SectionView
+  {
+  public:
+    class const_iterator
+    {
+    public:
+      EntryView operator*() const
+      {
+        return EntryView(*m_Document, m_Index);
+      }
+
+      const_iterator &operator++()
+      {
+        ++m_Index;
+        return *this;
+      }
+
+      bool operator==(const const_iterator &Other) const
+      {
+        return m_Index == Other.m_Index;
+      }
+
+      bool operator!=(const const_iterator &Other) const
+      {
+        return m_Index != Other.m_Index;
+      }
+
+    private:
+      friend class SectionView;
+
+      const_iterator(const IniDocument &Document, std::uint32_t Index)
+          : m_Document(&Document)
+          , m_Index(Index)
+      {}
+
+      const IniDocument *m_Document;
+      std::uint32_t      m_Index;
+    };
+
+    std::string_view         GetName() const;
+    std::size_t              GetNumEntries() const;
+    bool                     HasEntry(std::string_view Key) const;
+    std::optional<EntryView> TryGetEntry(std::string_view Key) const;
+    const_iterator           begin() const;
+    const_iterator           end() const;
+
+  private:
+    friend class IniDocument;
+
+    SectionView(const IniDocument &Document, std::uint32_t Index)
+        : m_Document(&Document)
+        , m_Index(Index)
+    {}
+
+    const IniDocument *m_Document;
+    std::uint32_t      m_Index;
+  };
+
+  IniDocument() = default;
+  IniDocument(const IniDocument &) = delete;
+  IniDocument(IniDocument &&) = default;
+
+  IniDocument &operator=(const IniDocument &) = delete;
+  IniDocument &operator=(IniDocument &&) = default;
+
+  // Replaces the contents of the document with the file, mapped when possible
+  bool ReadFile(const std::string &FileName, IniReadMode ReadMode = IniReadMode::MappedSequential);
+
+  // Replaces the contents of the document with a copy of Buffer
+  void ParseBuffer(std::string_view Buffer);
+
+  bool                       HasSection(std::string_view SectionName) const;
+  std::optional<SectionView> TryGetSection(std::string_view SectionName) const;
+  std::size_t                GetNumSections() const;
+  SectionView                GetSection(std::size_t Index) const;
+  std::string_view           GetText() const;
+  void                       Clear();
+
+private:
+  struct ScanHandler;
+
+  void                         Index();
+  std::optional<std::uint32_t> FindEntry(std::uint32_t Section, std::string_view Key) const;
+
+  IniMappedFile     m_File;
+  std::vector<char> m_Buffer;
+  std::string_view  m_Text;
+
+  std::vector<SectionRecord>                          m_Sections;
+  std::vector<EntryRecord>                            m_Entries;
+  std::vector<std::string_view>                       m_Values;
+  std::vector<std::uint32_t>                          m_SortedEntries;  // per section, entry indices sorted by key
+  std::unordered_map<std::string_view, std::uint32_t> m_SectionLookup;
+};
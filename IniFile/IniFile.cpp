@@ -1,184 +1,293 @@
-////////////////////////////////////////////////////////////
-//
-// MIT License
-//
-// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files(the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions :
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//
-// The origin of this software must not be misrepresented; you must not claim
-// that you wrote the original software.If you use this software in a product,
-// an acknowledgment of the software used is required.
-//
-////////////////////////////////////////////////////////////
-
-#include "IniFile.h"
-
-IniEntry::value_reverse_iterator_t IniEntry::rend()
-{
-  return m_ValueList.rend();
-}
-
-IniEntry &IniEntry::operator=(IniEntry &&Other)
-{
-  m_Key = std::move(Other.m_Key);
-  m_ValueList = std::move(Other.m_ValueList);
-  return *this;
-}
-
-IniEntry &IniEntry::operator=(const IniEntry &Other)
-{
-  m_Key = Other.m_Key;
-  m_ValueList = Other.m_ValueList;
-  return *this;
-}
-
-IniEntry::IniEntry(IniEntry &&Other)
-    : m_Key(std::move(Other.m_Key))
-    , m_ValueList(std::move(Other.m_ValueList))
-{
-}
-
-IniEntry::IniEntry(const IniEntry &Other)
-    : m_Key(Other.m_Key)
-    , m_ValueList(Other.m_ValueList)
-{
-}
-
-IniEntry::IniEntry(const std::string &Key, std::initializer_list<std::string> InitValues)
-    : m_Key(Key)
-    , m_ValueList(InitValues)
-{
-}
-
-IniEntry::IniEntry(const std::string &Key, const std::string &Value)
-    : m_Key(Key)
-    , m_ValueList(1, Value)
-{
-}
-
-IniEntry::IniEntry(const std::string &Key, std::size_t NumVals, const std::string &FillValue)
-    : m_Key(Key)
-    , m_ValueList(NumVals, FillValue)
-{
-}
-
-IniEntry::IniEntry(const std::string &Key)
-    : m_Key(Key)
-{
-}
-
-std::size_t IniEntry::GetValueCount() const
-{
-  return m_ValueList.size();
-}
-
-std::optional<std::string> IniEntry::TryGetValue() const
-{
-  if (m_ValueList.empty())
-    return std::nullopt;
-
-  return std::make_optional(m_ValueList.front());
-}
-
-const std::deque<std::string> &IniEntry::GetValues() const
-{
-  return m_ValueList;
-}
-
-std::optional<std::string> IniEntry::operator[](std::size_t ValIndex) const
-{
-  if (ValIndex >= m_ValueList.size())
-    return std::nullopt;
-
-  return std::make_optional(m_ValueList.at(ValIndex));
-}
-
-void IniEntry::AddValue(const std::string &Val)
-{
-  m_ValueList.emplace_back(Val);
-}
-
-void IniEntry::AddValueAtFront(const std::string &Val)
-{
-  m_ValueList.emplace_front(Val);
-}
-
-IniEntry::value_const_iterator_t IniEntry::cbegin() const
-{
-  return m_ValueList.cbegin();
-}
-
-IniEntry::value_const_iterator_t IniEntry::cend() const
-{
-  return m_ValueList.cend();
-}
-
-IniEntry::value_const_reverse_iterator_t IniEntry::begin() const
-{
-  return m_ValueList.crbegin();
-}
-
-IniEntry::value_iterator_t IniEntry::begin()
-{
-  return m_ValueList.begin();
-}
-
-IniEntry::value_const_reverse_iterator_t IniEntry::end() const
-{
-  return m_ValueList.crend();
-}
-
-IniEntry::value_iterator_t IniEntry::end()
-{
-  return m_ValueList.end();
-}
-
-IniEntry::value_reverse_iterator_t IniEntry::rbegin()
-{
-  return m_ValueList.rbegin();
-}
-
-std::tuple<bool, std::size_t> IniEntry::RemoveValue(std::size_t ValIndex)
-{
-  if (ValIndex >= m_ValueList.size() || m_ValueList.empty())
-    return std::make_tuple(false, m_ValueList.size());
-
-  m_ValueList.erase(m_ValueList.cbegin() + ValIndex);
-  return std::make_tuple(true, m_ValueList.size());
-}
-
-void IniEntry::Swap(IniEntry &Other)
-{
-  m_Key.swap(Other.m_Key);
-  m_ValueList.swap(Other.m_ValueList);
-}
-
-void IniEntry::Clear()
-{
-  m_ValueList.clear();
-}
-
-const std::string &IniEntry::GetKey() const
-{
-  return m_Key;
-}
-
-const std::regex IniFile::SectionHeaderRegex = std::regex(R"(\[(.+)\])");
-const std::regex IniFile::EntryRegex = std::regex(R"(\+?(\w+)=([^#;\n\r]+)*)");
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniFile.h"
+
+IniEntry::value_reverse_iterator_t IniEntry::rend()
+{
+  MarkExposed();
+  return m_ValueList.rend();
+}
+
+IniEntry &IniEntry::operator=(IniEntry &&Other) noexcept
+{
+  m_Key = std::move(Other.m_Key);
+  m_ValueList = std::move(Other.m_ValueList);
+  m_Converted = Other.m_Converted;
+  m_Dirty = true;
+  m_Exposed = m_Exposed || Other.m_Exposed;
+  return *this;
+}
+
+IniEntry &IniEntry::operator=(const IniEntry &Other)
+{
+  m_Key = Other.m_Key;
+  m_ValueList = Other.m_ValueList;
+  m_Converted = Other.m_Converted;
+  m_Dirty = true;
+  return *this;
+}
+
+IniEntry::IniEntry(IniEntry &&Other) noexcept
+    : m_ValueList(std::move(Other.m_ValueList))
+    , m_Key(std::move(Other.m_Key))
+    , m_Converted(Other.m_Converted)
+    , m_Dirty(Other.m_Dirty)
+    , m_Exposed(Other.m_Exposed)
+{
+}
+
+IniEntry::IniEntry(const IniEntry &Other)
+    : m_ValueList(Other.m_ValueList)
+    , m_Key(Other.m_Key)
+    , m_Converted(Other.m_Converted)
+    , m_Dirty(Other.m_Dirty)
+{
+}
+
+IniEntry::IniEntry(IniEntry &&Other, allocator_type Alloc)
+    : m_ValueList(std::move(Other.m_ValueList), Alloc)
+    , m_Key(std::move(Other.m_Key), Alloc)
+    , m_Converted(Other.m_Converted)
+    , m_Dirty(Other.m_Dirty)
+    , m_Exposed(Other.m_Exposed)
+{
+}
+
+IniEntry::IniEntry(const IniEntry &Other, allocator_type Alloc)
+    : m_ValueList(Other.m_ValueList, Alloc)
+    , m_Key(Other.m_Key, Alloc)
+    , m_Converted(Other.m_Converted)
+    , m_Dirty(Other.m_Dirty)
+{
+}
+
+IniEntry::IniEntry(std::string_view Key, std::initializer_list<std::string_view> InitValues, allocator_type Alloc)
+    : m_ValueList(Alloc)
+    , m_Key(Key, Alloc)
+{
+  for (std::string_view Value : InitValues)
+    m_ValueList.emplace_back(Value);
+}
+
+IniEntry::IniEntry(std::string_view Key, std::string_view Value, allocator_type Alloc)
+    : m_ValueList(Alloc)
+    , m_Key(Key, Alloc)
+{
+  m_ValueList.emplace_back(Value);
+}
+
+IniEntry::IniEntry(std::string_view Key, std::size_t NumVals, std::string_view FillValue, allocator_type Alloc)
+    : m_ValueList(Alloc)
+    , m_Key(Key, Alloc)
+{
+  for (std::size_t i = 0; i < NumVals; ++i)
+    m_ValueList.emplace_back(FillValue);
+}
+
+IniEntry::IniEntry(std::string_view Key, allocator_type Alloc)
+    : m_ValueList(Alloc)
+    , m_Key(Key, Alloc)
+{
+}
+
+std::size_t IniEntry::GetValueCount() const
+{
+  return m_ValueList.size();
+}
+
+std::optional<std::string> IniEntry::TryGetValue() const
+{
+  if (m_ValueList.empty())
+    return std::nullopt;
+
+  return std::make_optional(std::string(m_ValueList.front()));
+}
+
+std::optional<std::string_view> IniEntry::TryGetValueView() const
+{
+  if (m_ValueList.empty())
+    return std::nullopt;
+
+  return std::make_optional(std::string_view(m_ValueList.front()));
+}
+
+std::optional<std::string_view> IniEntry::GetValueView(std::size_t ValIndex) const
+{
+  if (ValIndex >= m_ValueList.size())
+    return std::nullopt;
+
+  return std::make_optional(std::string_view(m_ValueList[ValIndex]));
+}
+
+const IniEntry::value_list_t &IniEntry::GetValues() const
+{
+  return m_ValueList;
+}
+
+std::optional<std::string> IniEntry::operator[](std::size_t ValIndex) const
+{
+  if (ValIndex >= m_ValueList.size())
+    return std::nullopt;
+
+  return std::make_optional(std::string(m_ValueList.at(ValIndex)));
+}
+
+void IniEntry::AddValue(std::string_view Val)
+{
+  MarkChanged();
+  m_ValueList.emplace_back(Val);
+}
+
+void IniEntry::AddValueAtFront(std::string_view Val)
+{
+  MarkChanged();
+  m_ValueList.emplace_front(Val);
+}
+
+IniEntry::value_const_iterator_t IniEntry::cbegin() const
+{
+  return m_ValueList.cbegin();
+}
+
+IniEntry::value_const_iterator_t IniEntry::cend() const
+{
+  return m_ValueList.cend();
+}
+
+IniEntry::value_const_reverse_iterator_t IniEntry::begin() const
+{
+  return m_ValueList.crbegin();
+}
+
+IniEntry::value_iterator_t IniEntry::begin()
+{
+  MarkExposed();
+  return m_ValueList.begin();
+}
+
+IniEntry::value_const_reverse_iterator_t IniEntry::end() const
+{
+  return m_ValueList.crend();
+}
+
+IniEntry::value_iterator_t IniEntry::end()
+{
+  MarkExposed();
+  return m_ValueList.end();
+}
+
+IniEntry::value_reverse_iterator_t IniEntry::rbegin()
+{
+  MarkExposed();
+  return m_ValueList.rbegin();
+}
+
+std::tuple<bool, std::size_t> IniEntry::RemoveValue(std::size_t ValIndex)
+{
+  if (ValIndex >= m_ValueList.size() || m_ValueList.empty())
+    return std::make_tuple(false, m_ValueList.size());
+
+  MarkChanged();
+  m_ValueList.erase(m_ValueList.cbegin() + ValIndex);
+  return std::make_tuple(true, m_ValueList.size());
+}
+
+void IniEntry::Swap(IniEntry &Other)
+{
+  // Containers can only swap storage when they share a memory_resource
+  if (get_allocator() == Other.get_allocator())
+  {
+    m_Key.swap(Other.m_Key);
+    m_ValueList.swap(Other.m_ValueList);
+    std::swap(m_Converted, Other.m_Converted);
+    m_Dirty = Other.m_Dirty = true;
+    m_Exposed = Other.m_Exposed = (m_Exposed || Other.m_Exposed);
+    return;
+  }
+
+  IniEntry Temp(std::move(*this));
+  *this = std::move(Other);
+  Other = std::move(Temp);
+}
+
+void IniEntry::Clear()
+{
+  MarkChanged();
+  m_ValueList.clear();
+
+  // Every value an iterator could point at is gone
+  m_Exposed = false;
+}
+
+const std::pmr::string &IniEntry::GetKey() const
+{
+  return m_Key;
+}
+
+bool IniEntry::IsDirty() const
+{
+  return m_Dirty;
+}
+
+void IniEntry::ClearDirty()
+{
+  m_Dirty = false;
+}
+
+IniEntry::allocator_type IniEntry::get_allocator() const
+{
+  return m_Key.get_allocator();
+}
+
+std::uint64_t IniSection::GetContentHash() const
+{
+  if (m_HasContentHash && !IsDirty())
+    return m_ContentHash;
+
+  std::uint64_t Hash = 0;
+  for (auto it = m_Entries.cbegin(); it != m_Entries.cend(); ++it)
+  {
+    const std::uint64_t KeyHash = IniHashString(it->second.GetKey());
+    Hash += ContentHashOfKey(KeyHash);
+
+    std::size_t Index = 0;
+    for (const std::pmr::string &Value : it->second.GetValues())
+      Hash += ContentHashOfValue(KeyHash, Index++, Value);
+  }
+
+  m_ContentHash = Hash;
+  m_HasContentHash = !IsDirty();
+  return Hash;
+}
+
+const std::regex IniFile::SectionHeaderRegex = std::regex(R"(\[(.+)\])");
+// Keep a single quantifier on the value group, ([^#;\n\r]+)* backtracks heavily on long values
+const std::regex IniFile::EntryRegex = std::regex(R"(\+?(\w+)=([^#;\n\r]*))");
@@ -1,377 +1,1139 @@
-////////////////////////////////////////////////////////////
-//
-// MIT License
-//
-// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
-//
-// Permission is hereby granted, free of charge, to any person obtaining a copy
-// of this software and associated documentation files(the "Software"), to deal
-// in the Software without restriction, including without limitation the rights
-// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
-// copies of the Software, and to permit persons to whom the Software is
-// furnished to do so, subject to the following conditions :
-//
-// The above copyright notice and this permission notice shall be included in all
-// copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
-// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
-// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
-// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
-// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
-// SOFTWARE.
-//
-// The origin of this software must not be misrepresented; you must not claim
-// that you wrote the original software.If you use this software in a product,
-// an acknowledgment of the software used is required.
-//
-////////////////////////////////////////////////////////////
-
-#pragma once
-
-#include <algorithm>
-#include <cctype>
-#include <deque>
-#include <fstream>
-#include <initializer_list>
-#include <iterator>
-#include <locale>
-#include <optional>
-#include <regex>
-#include <string>
-#include <tuple>
-#include <type_traits>
-#include <unordered_map>
-#include <utility>
-
-struct IniEntry
-{
-  IniEntry(const std::string &Key);
-  explicit IniEntry(const std::string &Key, std::size_t NumVals, const std::string &FillValue);
-  IniEntry(const std::string &Key, const std::string &Value);
-  IniEntry(const std::string &Key, std::initializer_list<std::string> InitValues);
-
-  template<class... Vals>
-  IniEntry(const std::string &Key, const std::string &Val1, Vals... OtherVals);
-
-  IniEntry(const IniEntry &Other);
-  IniEntry(IniEntry &&Other);
-
-  IniEntry &operator=(const IniEntry &Other);
-  IniEntry &operator=(IniEntry &&Other);
-
-  inline friend bool IniEntry::operator<(const IniEntry &LHS, const IniEntry &RHS)
-  {
-    return (LHS.m_Key < RHS.m_Key);
-  }
-
-  inline friend bool IniEntry::operator>(const IniEntry &LHS, const IniEntry &RHS)
-  {
-    return (LHS.m_Key > RHS.m_Key);
-  }
-
-  inline friend bool IniEntry::operator==(const IniEntry &LHS, const IniEntry &RHS)
-  {
-    return (LHS.m_Key == RHS.m_Key);
-  }
-
-  std::size_t                    GetValueCount() const;
-  std::optional<std::string>     TryGetValue() const;
-  const std::deque<std::string> &GetValues() const;
-  std::optional<std::string>     operator[](std::size_t ValIndex) const;
-  void                           AddValue(const std::string &Val);
-
-  template<class... Vals>
-  void AddValue(const std::string &Val, Vals... vals);
-
-private:
-  void AddValueAtFront(const std::string &Val);
-
-  template<class... Vals>
-  IniEntry::IniEntry(const std::string &Key, const std::string &Val1, Vals... OtherVals)
-  {
-    static_assert(std::conjunction<std::is_same<std::string, Vals>...>::value || std::conjunction<std::is_same<const char *, Vals>...>::value, "IniEntry values must of a string type");
-
-    m_Key = Key;
-    AddValueAtFront(Val1, std::forward<Vals>(OtherVals)...);
-  }
-
-  template<class... Vals>
-  void IniEntry::AddValue(const std::string &Val, Vals... vals)
-  {
-    m_ValueList.emplace_back(Val);
-    AddValue(std::forward<Vals>(vals)...);
-  }
-
-  template<class... Vals>
-  void IniEntry::AddValueAtFront(const std::string &Val, Vals... vals)
-  {
-    m_ValueList.emplace_front(Val);
-    AddValueAtFront(std::forward<Vals>(vals)...);
-  }
-
-  template<class... Vals>
-  void AddValueAtFront(const std::string &Val, Vals... vals);
-
-  using value_const_iterator_t = typename std::deque<std::string>::const_iterator;
-  using value_const_reverse_iterator_t = typename std::deque<std::string>::const_reverse_iterator;
-  using value_iterator_t = typename std::deque<std::string>::iterator;
-  using value_reverse_iterator_t = typename std::deque<std::string>::reverse_iterator;
-
-public:
-  value_const_iterator_t         cbegin() const;
-  value_const_iterator_t         cend() const;
-  value_iterator_t               begin();
-  value_iterator_t               end();
-  value_reverse_iterator_t       rbegin();
-  value_reverse_iterator_t       rend();
-  value_const_reverse_iterator_t begin() const;
-  value_const_reverse_iterator_t end() const;
-  std::tuple<bool, std::size_t>  RemoveValue(std::size_t ValIndex);
-  void                           Swap(IniEntry &Other);
-  void                           Clear();
-  const std::string &            GetKey() const;
-
-private:
-  std::deque<std::string> m_ValueList;
-  std::string             m_Key{""};
-};
-
-class IniSection
-{
-public:
-  using entry_iterator_t = typename std::unordered_map<std::string, IniEntry>::iterator;
-  using entry_const_iterator_t = typename std::unordered_map<std::string, IniEntry>::const_iterator;
-
-  entry_iterator_t begin()
-  {
-    return m_Entries.begin();
-  }
-
-  entry_iterator_t end()
-  {
-    return m_Entries.end();
-  }
-
-  entry_const_iterator_t cbegin() const
-  {
-    return m_Entries.cbegin();
-  }
-
-  entry_const_iterator_t cend() const
-  {
-    return m_Entries.cend();
-  }
-
-  IniSection(const IniSection &Other)
-      : m_SectionName(Other.m_SectionName)
-      , m_Entries(Other.m_Entries)
-  {}
-
-  IniSection(IniSection &&Other)
-      : m_SectionName(std::move(Other.m_SectionName))
-      , m_Entries(std::move(Other.m_Entries))
-  {}
-
-  IniSection &operator=(const IniSection &Other)
-  {
-    m_SectionName = Other.m_SectionName;
-    m_Entries = Other.m_Entries;
-    return *this;
-  }
-
-  IniSection &operator=(IniSection &&Other)
-  {
-    m_SectionName = std::move(Other.m_SectionName);
-    m_Entries = std::move(Other.m_Entries);
-    return *this;
-  }
-
-  IniSection(const std::string &SectionName)
-      : m_SectionName(SectionName)
-  {}
-
-  bool HasEntry(const std::string &Key)
-  {
-    return (m_Entries.find(Key) != m_Entries.cend());
-  }
-
-  std::optional<std::reference_wrapper<IniEntry>> TryGetEntry(const std::string &Key)
-  {
-    entry_iterator_t it = m_Entries.find(Key);
-
-    if (it == m_Entries.end())
-      return std::nullopt;
-
-    return std::make_optional(std::reference_wrapper<IniEntry>((*it).second));
-  }
-
-  IniEntry &CreateEntry(const std::string &Key)
-  {
-    auto res = m_Entries.emplace(Key, IniEntry(Key));
-    return m_Entries.at(Key);
-  }
-
-  void AddEntry(const IniEntry &Entry)
-  {
-    m_Entries.emplace(Entry.GetKey(), Entry);
-  }
-
-  std::size_t GetNumEntries() const
-  {
-    return m_Entries.size();
-  }
-
-  const std::string &GetName() const
-  {
-    return m_SectionName;
-  }
-
-  void RemoveEntry(const std::string &Key)
-  {
-    auto it = m_Entries.find(Key);
-    if (it != m_Entries.end())
-    {
-      m_Entries.erase(it);
-    }
-  }
-
-  IniEntry &operator[](const std::string &Key)
-  {
-    auto it = m_Entries.find(Key);
-    if (it == m_Entries.end())
-      m_Entries.emplace(Key, Key);
-
-    return m_Entries.at(Key);
-  }
-
-  void Clear()
-  {
-    m_Entries.clear();
-  }
-
-private:
-  std::string                               m_SectionName;
-  std::unordered_map<std::string, IniEntry> m_Entries;
-};
-
-class IniFile
-{
-public:
-  IniFile(const std::string &FileName)
-      : m_FileName(FileName)
-  {
-    if (!FileName.empty() && !ReadFile(FileName))
-      throw std::runtime_error("Failed to read ini file");
-  }
-
-  bool ReadFile(const std::string &FileName)
-  {
-    std::ifstream in(FileName, std::ios_base::in);
-    return ParseFile(in);
-  }
-
-  bool HasSection(const std::string &SectionName) const
-  {
-    return (m_Sections.find(SectionName) != m_Sections.end());
-  }
-
-  std::optional<std::reference_wrapper<IniSection>> TryGetSection(const std::string &SectionName)
-  {
-    auto it = m_Sections.find(SectionName);
-    if (it == m_Sections.end())
-      return std::nullopt;
-
-    return std::make_optional(std::reference_wrapper<IniSection>(m_Sections.at(SectionName)));
-  }
-
-private:
-  using section_iterator_t = typename std::unordered_map<std::string, IniSection>::iterator;
-  using section_const_iterator_t = typename std::unordered_map<std::string, IniSection>::const_iterator;
-
-public:
-  section_iterator_t begin()
-  {
-    return m_Sections.begin();
-  }
-
-  section_iterator_t end()
-  {
-    return m_Sections.end();
-  }
-
-  section_const_iterator_t cbegin() const
-  {
-    return m_Sections.cbegin();
-  }
-
-  section_const_iterator_t cend() const
-  {
-    return m_Sections.cend();
-  }
-
-  const std::string &GetFileName() const
-  {
-    return m_FileName;
-  }
-
-private:
-  bool ParseFile(std::ifstream &InFile)
-  {
-    if (!InFile)
-      return false;
-
-    std::string CurrentLine;
-
-    while (InFile && std::getline(InFile, CurrentLine))
-    {
-      if (CurrentLine.empty() || CurrentLine.front() == '\n' || CurrentLine.front() == '#' || CurrentLine.front() == ';')
-        continue;
-
-      std::smatch Match;
-      if (std::regex_search(CurrentLine, Match, SectionHeaderRegex))
-      {
-        IniSection Section(Match[1].str());
-        ParseSection(Section, InFile);
-        m_Sections.emplace(Section.GetName(), Section);
-      }
-    }
-
-    return true;
-  }
-
-  void ParseSection(IniSection &Section, std::ifstream &InFile)
-  {
-    std::string CurrentLine;
-    std::smatch Match;
-
-    auto TrimWhitespaceFromEnd = [](std::string &ToTrim) {
-      ToTrim.erase(std::find_if(ToTrim.rbegin(), ToTrim.rend(), [](int ch) { return !std::isspace(ch); }).base(), ToTrim.end());
-    };
-
-    while (InFile && std::getline(InFile, CurrentLine) && !CurrentLine.empty() && (CurrentLine.front() != '\n'))
-    {
-      if (std::regex_search(CurrentLine, Match, EntryRegex))
-      {
-        std::string ValueString(Match[2]);
-        TrimWhitespaceFromEnd(ValueString);
-
-        if (CurrentLine.front() == '+')
-        {
-          Section[Match[1]].AddValue(ValueString);
-        }
-        else
-        {
-          Section.CreateEntry(Match[1]).AddValue(ValueString);
-        }
-      }
-    }
-  }
-
-  std::unordered_map<std::string, IniSection> m_Sections;
-  std::string                                 m_FileName;
-
-  static const std::regex SectionHeaderRegex;
-  static const std::regex EntryRegex;
-};
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniConvert.h"
+#include "IniFlatMap.h"
+#include "IniMappedFile.h"
+#include "IniScanner.h"
+#include "IniSmallVector.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <istream>
+#include <ostream>
+#include <iterator>
+#include <locale>
+#include <memory_resource>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+struct IniEntry
+{
+  // Keys and values are allocated from the memory_resource of the allocator
+  // (the default resource unless one is given), so a whole file can be parsed
+  // into an arena such as std::pmr::monotonic_buffer_resource
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+  // Nearly every entry has one or two values, keep those inside the entry
+  using value_list_t = IniSmallVector<std::pmr::string, 2>;
+
+  IniEntry(std::string_view Key, allocator_type Alloc = {});
+  explicit IniEntry(std::string_view Key, std::size_t NumVals, std::string_view FillValue, allocator_type Alloc = {});
+  IniEntry(std::string_view Key, std::string_view Value, allocator_type Alloc = {});
+  IniEntry(std::string_view Key, std::initializer_list<std::string_view> InitValues, allocator_type Alloc = {});
+
+  template<class... Vals>
+  IniEntry(const std::string &Key, const std::string &Val1, Vals... OtherVals);
+
+  IniEntry(const IniEntry &Other);
+  IniEntry(IniEntry &&Other) noexcept;
+  IniEntry(const IniEntry &Other, allocator_type Alloc);
+  IniEntry(IniEntry &&Other, allocator_type Alloc);
+
+  IniEntry &operator=(const IniEntry &Other);
+  IniEntry &operator=(IniEntry &&Other) noexcept;
+
+  inline friend bool operator<(const IniEntry &LHS, const IniEntry &RHS)
+  {
+    return (LHS.m_Key < RHS.m_Key);
+  }
+
+  inline friend bool operator>(const IniEntry &LHS, const IniEntry &RHS)
+  {
+    return (LHS.m_Key > RHS.m_Key);
+  }
+
+  inline friend bool operator==(const IniEntry &LHS, const IniEntry &RHS)
+  {
+    return (LHS.m_Key == RHS.m_Key);
+  }
+
+  std::size_t                GetValueCount() const;
+  std::optional<std::string> TryGetValue() const;
+  const value_list_t &       GetValues() const;
+  std::optional<std::string> operator[](std::size_t ValIndex) const;
+  void                       AddValue(std::string_view Val);
+
+  // Same as TryGetValue and operator[] without copying the value. The view is
+  // into the entry and is invalidated by anything that changes its values.
+  std::optional<std::string_view> TryGetValueView() const;
+  std::optional<std::string_view> GetValueView(std::size_t ValIndex) const;
+
+  // Typed reads of the value at ValIndex, see IniConvert for the accepted
+  // formats. std::nullopt when there is no such value or it does not convert.
+  //
+  // The last successful GetInt, GetDouble or GetBool is remembered, so reading
+  // the same value as the same type again is a compare and a load. Anything
+  // that can change the values forgets it. A non-const iterator can still write
+  // after it was handed out, so once one has been taken nothing is remembered
+  // until the values are cleared. Since these const functions write the cache,
+  // an entry must not be read from several threads at once.
+  std::optional<std::int64_t> GetInt(std::size_t ValIndex = 0) const;
+  std::optional<double>       GetDouble(std::size_t ValIndex = 0) const;
+  std::optional<bool>         GetBool(std::size_t ValIndex = 0) const;
+
+  template<class T>
+  std::optional<T> GetAs(std::size_t ValIndex = 0) const;
+
+  // Converts every value of the entry to T and writes them to Out, stops and
+  // returns false at the first value that does not convert
+  template<class T, class OutputIt>
+  bool GetList(OutputIt Out) const;
+
+  template<class... Vals>
+  void AddValue(std::string_view Val, Vals... vals);
+
+private:
+  void AddValueAtFront(std::string_view Val);
+
+  template<class... Vals>
+  void AddValueAtFront(std::string_view Val, Vals... vals);
+
+  using value_const_iterator_t = typename value_list_t::const_iterator;
+  using value_const_reverse_iterator_t = typename value_list_t::const_reverse_iterator;
+  using value_iterator_t = typename value_list_t::iterator;
+  using value_reverse_iterator_t = typename value_list_t::reverse_iterator;
+
+public:
+  value_const_iterator_t         cbegin() const;
+  value_const_iterator_t         cend() const;
+  value_iterator_t               begin();
+  value_iterator_t               end();
+  value_reverse_iterator_t       rbegin();
+  value_reverse_iterator_t       rend();
+  value_const_reverse_iterator_t begin() const;
+  value_const_reverse_iterator_t end() const;
+  std::tuple<bool, std::size_t>  RemoveValue(std::size_t ValIndex);
+  void                           Swap(IniEntry &Other);
+  void                           Clear();
+  const std::pmr::string &       GetKey() const;
+  allocator_type                 get_allocator() const;
+
+  // Set by anything that can change the values (the same calls that forget
+  // the converted value, so handing out non-const iterators counts), cleared
+  // by ClearDirty and by IniFile when it reads or saves the file
+  bool IsDirty() const;
+  void ClearDirty();
+
+private:
+  struct ConvertedValue
+  {
+    enum class Type : std::uint8_t
+    {
+      None,
+      Int,
+      Double,
+      Bool
+    };
+
+    Type          Kind = Type::None;
+    std::uint32_t ValIndex = 0;
+
+    union
+    {
+      std::int64_t Int;
+      double       Double;
+      bool         Bool;
+    };
+
+    bool Holds(Type InKind, std::size_t InValIndex) const
+    {
+      return (Kind == InKind && ValIndex == InValIndex);
+    }
+  };
+
+  void ForgetConverted()
+  {
+    m_Converted.Kind = ConvertedValue::Type::None;
+  }
+
+  void MarkChanged()
+  {
+    ForgetConverted();
+    m_Dirty = true;
+  }
+
+  // For the non-const iterators, which can write at any time after this
+  void MarkExposed()
+  {
+    MarkChanged();
+    m_Exposed = true;
+  }
+
+  value_list_t           m_ValueList;
+  std::pmr::string       m_Key;
+  mutable ConvertedValue m_Converted;
+  bool                   m_Dirty = false;
+  bool                   m_Exposed = false;  // a non-const iterator was handed out
+};
+
+template<class... Vals>
+IniEntry::IniEntry(const std::string &Key, const std::string &Val1, Vals... OtherVals)
+    : m_Key(Key.data(), Key.size())
+{
+  static_assert(std::conjunction<std::is_same<std::string, Vals>...>::value || std::conjunction<std::is_same<const char *, Vals>...>::value, "IniEntry values must of a string type");
+
+  AddValueAtFront(Val1, std::forward<Vals>(OtherVals)...);
+}
+
+template<class T>
+std::optional<T> IniEntry::GetAs(std::size_t ValIndex) const
+{
+  T Value{};
+  if (ValIndex >= m_ValueList.size() || !IniConvert::Parse(m_ValueList[ValIndex], Value))
+    return std::nullopt;
+
+  return Value;
+}
+
+inline std::optional<std::int64_t> IniEntry::GetInt(std::size_t ValIndex) const
+{
+  if (m_Converted.Holds(ConvertedValue::Type::Int, ValIndex))
+    return m_Converted.Int;
+
+  std::optional<std::int64_t> Value = GetAs<std::int64_t>(ValIndex);
+  if (Value && !m_Exposed)
+  {
+    m_Converted.Kind = ConvertedValue::Type::Int;
+    m_Converted.ValIndex = static_cast<std::uint32_t>(ValIndex);
+    m_Converted.Int = *Value;
+  }
+
+  return Value;
+}
+
+inline std::optional<double> IniEntry::GetDouble(std::size_t ValIndex) const
+{
+  if (m_Converted.Holds(ConvertedValue::Type::Double, ValIndex))
+    return m_Converted.Double;
+
+  std::optional<double> Value = GetAs<double>(ValIndex);
+  if (Value && !m_Exposed)
+  {
+    m_Converted.Kind = ConvertedValue::Type::Double;
+    m_Converted.ValIndex = static_cast<std::uint32_t>(ValIndex);
+    m_Converted.Double = *Value;
+  }
+
+  return Value;
+}
+
+inline std::optional<bool> IniEntry::GetBool(std::size_t ValIndex) const
+{
+  if (m_Converted.Holds(ConvertedValue::Type::Bool, ValIndex))
+    return m_Converted.Bool;
+
+  std::optional<bool> Value = GetAs<bool>(ValIndex);
+  if (Value && !m_Exposed)
+  {
+    m_Converted.Kind = ConvertedValue::Type::Bool;
+    m_Converted.ValIndex = static_cast<std::uint32_t>(ValIndex);
+    m_Converted.Bool = *Value;
+  }
+
+  return Value;
+}
+
+template<class T, class OutputIt>
+bool IniEntry::GetList(OutputIt Out) const
+{
+  for (const std::pmr::string &Value : m_ValueList)
+  {
+    T Converted{};
+    if (!IniConvert::Parse(Value, Converted))
+      return false;
+
+    *Out++ = Converted;
+  }
+
+  return true;
+}
+
+template<class... Vals>
+void IniEntry::AddValue(std::string_view Val, Vals... vals)
+{
+  MarkChanged();
+  m_ValueList.emplace_back(Val);
+  AddValue(std::forward<Vals>(vals)...);
+}
+
+template<class... Vals>
+void IniEntry::AddValueAtFront(std::string_view Val, Vals... vals)
+{
+  MarkChanged();
+  m_ValueList.emplace_front(Val);
+  AddValueAtFront(std::forward<Vals>(vals)...);
+}
+
+// Hash of section names and entry keys
+//
+// Unlike std::hash this is constexpr, so the hash of a name known at compile
+// time (see IniHashedName) is computed by the compiler. Words are assembled
+// from bytes with shifts, which compilers turn back into plain loads, and the
+// tail is read as a last overlapping word instead of byte by byte.
+constexpr std::uint64_t IniHashString(std::string_view Str) noexcept
+{
+  constexpr std::uint64_t Multiplier = 0x9E3779B97F4A7C15ull;
+
+  auto Byte = [&Str](std::size_t Offset) {
+    return static_cast<std::uint64_t>(static_cast<unsigned char>(Str[Offset]));
+  };
+
+  auto Load4 = [&Byte](std::size_t Offset) {
+    return Byte(Offset) | (Byte(Offset + 1) << 8) | (Byte(Offset + 2) << 16) | (Byte(Offset + 3) << 24);
+  };
+
+  auto Load8 = [&Load4](std::size_t Offset) {
+    return Load4(Offset) | (Load4(Offset + 4) << 32);
+  };
+
+  auto Mix = [](std::uint64_t Hash, std::uint64_t Word) {
+    Hash = (Hash ^ Word) * Multiplier;
+    return Hash ^ (Hash >> 29);
+  };
+
+  const std::size_t Size = Str.size();
+  std::uint64_t     Hash = (Size + 1) * Multiplier;
+
+  if (Size >= 8)
+  {
+    std::size_t Offset = 0;
+    for (; Offset + 8 < Size; Offset += 8)
+      Hash = Mix(Hash, Load8(Offset));
+
+    Hash = Mix(Hash, Load8(Size - 8));
+  }
+  else if (Size >= 4)
+  {
+    Hash = Mix(Hash, (Load4(0) << 32) | Load4(Size - 4));
+  }
+  else if (Size > 0)
+  {
+    Hash = Mix(Hash, (Byte(0) << 16) | (Byte(Size / 2) << 8) | Byte(Size - 1));
+  }
+
+  // Final avalanche (MurmurHash3's fmix64) so every input bit reaches the
+  // high bits the tables use. One multiply round left short names that only
+  // differ in their last character, like Key_0 to Key_9, sharing buckets.
+  Hash ^= Hash >> 33;
+  Hash *= 0xFF51AFD7ED558CCDull;
+  Hash ^= Hash >> 33;
+  Hash *= 0xC4CEB9FE1A85EC53ull;
+  return Hash ^ (Hash >> 33);
+}
+
+// Hashes every string type as a std::string_view, so sections and entries can
+// be looked up with literals and views without building a temporary key
+struct IniStringHash
+{
+  using is_transparent = void;
+
+  constexpr std::size_t operator()(std::string_view Str) const noexcept
+  {
+    return static_cast<std::size_t>(IniHashString(Str));
+  }
+};
+
+// A section name or entry key with its hash computed up front
+//
+// Declare these constexpr for names used on hot paths, the lookups that take
+// them go straight to the bucket without hashing at runtime:
+//   static constexpr IniHashedName Server("Server");
+//   static constexpr IniKey        ServerPort("Server", "Port");
+struct IniHashedName
+{
+  constexpr explicit IniHashedName(std::string_view InName)
+      : Name(InName)
+      , Hash(IniStringHash{}(InName))
+  {}
+
+  std::string_view Name;
+  std::size_t      Hash;
+};
+
+// Section.Key path of an entry, with both hashes computed up front
+struct IniKey
+{
+  constexpr IniKey(std::string_view SectionName, std::string_view EntryKey)
+      : Section(SectionName)
+      , Entry(EntryKey)
+  {}
+
+  IniHashedName Section;
+  IniHashedName Entry;
+};
+
+class IniSection
+{
+public:
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+  using entry_map_t = IniFlatMap<std::pmr::string, IniEntry, IniStringHash, std::equal_to<>>;
+  using entry_iterator_t = typename entry_map_t::iterator;
+  using entry_const_iterator_t = typename entry_map_t::const_iterator;
+
+  entry_iterator_t begin()
+  {
+    return m_Entries.begin();
+  }
+
+  entry_iterator_t end()
+  {
+    return m_Entries.end();
+  }
+
+  entry_const_iterator_t cbegin() const
+  {
+    return m_Entries.cbegin();
+  }
+
+  entry_const_iterator_t cend() const
+  {
+    return m_Entries.cend();
+  }
+
+  IniSection(const IniSection &Other)
+      : m_SectionName(Other.m_SectionName)
+      , m_Entries(Other.m_Entries)
+      , m_Source(Other.m_Source)
+      , m_Dirty(Other.m_Dirty)
+      , m_ContentHash(Other.m_ContentHash)
+      , m_HasContentHash(Other.m_HasContentHash)
+  {}
+
+  IniSection(IniSection &&Other) noexcept
+      : m_SectionName(std::move(Other.m_SectionName))
+      , m_Entries(std::move(Other.m_Entries))
+      , m_Source(Other.m_Source)
+      , m_Dirty(Other.m_Dirty)
+      , m_ContentHash(Other.m_ContentHash)
+      , m_HasContentHash(Other.m_HasContentHash)
+  {}
+
+  IniSection(const IniSection &Other, allocator_type Alloc)
+      : m_SectionName(Other.m_SectionName, Alloc)
+      , m_Entries(Other.m_Entries, Alloc)
+      , m_Source(Other.m_Source)
+      , m_Dirty(Other.m_Dirty)
+      , m_ContentHash(Other.m_ContentHash)
+      , m_HasContentHash(Other.m_HasContentHash)
+  {}
+
+  IniSection(IniSection &&Other, allocator_type Alloc)
+      : m_SectionName(std::move(Other.m_SectionName), Alloc)
+      , m_Entries(std::move(Other.m_Entries), Alloc)
+      , m_Source(Other.m_Source)
+      , m_Dirty(Other.m_Dirty)
+      , m_ContentHash(Other.m_ContentHash)
+      , m_HasContentHash(Other.m_HasContentHash)
+  {}
+
+  // The section keeps its own place in the source file
+  IniSection &operator=(const IniSection &Other)
+  {
+    m_SectionName = Other.m_SectionName;
+    m_Entries = Other.m_Entries;
+    m_Dirty = true;
+    return *this;
+  }
+
+  IniSection &operator=(IniSection &&Other) noexcept
+  {
+    m_SectionName = std::move(Other.m_SectionName);
+    m_Entries = std::move(Other.m_Entries);
+    m_Dirty = true;
+    return *this;
+  }
+
+  IniSection(std::string_view SectionName, allocator_type Alloc = {})
+      : m_SectionName(SectionName, Alloc)
+      , m_Entries(Alloc)
+  {}
+
+  bool HasEntry(std::string_view Key)
+  {
+    return (m_Entries.find(Key) != m_Entries.cend());
+  }
+
+  std::optional<std::reference_wrapper<IniEntry>> TryGetEntry(std::string_view Key)
+  {
+    entry_iterator_t it = m_Entries.find(Key);
+
+    if (it == m_Entries.end())
+      return std::nullopt;
+
+    return std::make_optional(std::reference_wrapper<IniEntry>((*it).second));
+  }
+
+  bool HasEntry(const IniHashedName &Key)
+  {
+    return (m_Entries.find(Key.Name, Key.Hash) != m_Entries.cend());
+  }
+
+  std::optional<std::reference_wrapper<IniEntry>> TryGetEntry(const IniHashedName &Key)
+  {
+    entry_iterator_t it = m_Entries.find(Key.Name, Key.Hash);
+
+    if (it == m_Entries.end())
+      return std::nullopt;
+
+    return std::make_optional(std::reference_wrapper<IniEntry>((*it).second));
+  }
+
+  IniEntry &CreateEntry(std::string_view Key)
+  {
+    // The map constructs the key and the entry with the section's allocator
+    auto Res = m_Entries.try_emplace(Key, Key);
+    m_Dirty |= Res.second;
+    return Res.first->second;
+  }
+
+  void AddEntry(const IniEntry &Entry)
+  {
+    m_Dirty |= m_Entries.emplace(Entry.GetKey(), Entry).second;
+  }
+
+  std::size_t GetNumEntries() const
+  {
+    return m_Entries.size();
+  }
+
+  const std::pmr::string &GetName() const
+  {
+    return m_SectionName;
+  }
+
+  void RemoveEntry(std::string_view Key)
+  {
+    auto it = m_Entries.find(Key);
+    if (it != m_Entries.end())
+    {
+      m_Entries.erase(it);
+      m_Dirty = true;
+    }
+  }
+
+  IniEntry &operator[](std::string_view Key)
+  {
+    // Hits do not allocate, the key is only copied into the section's arena
+    // when the entry is created
+    auto Res = m_Entries.try_emplace(Key, Key);
+    m_Dirty |= Res.second;
+    return Res.first->second;
+  }
+
+  void Clear()
+  {
+    m_Dirty |= !m_Entries.empty();
+    m_Entries.clear();
+  }
+
+  // True when entries were added or removed, or any entry is dirty. A
+  // section that was not read from the source file is always dirty until
+  // cleared.
+  bool IsDirty() const
+  {
+    if (m_Dirty)
+      return true;
+
+    for (auto it = m_Entries.cbegin(); it != m_Entries.cend(); ++it)
+      if (it->second.IsDirty())
+        return true;
+
+    return false;
+  }
+
+  void ClearDirty()
+  {
+    // Whatever made the section dirty may have changed its contents
+    if (IsDirty())
+      m_HasContentHash = false;
+
+    m_Dirty = false;
+    for (auto it = m_Entries.begin(); it != m_Entries.end(); ++it)
+      it->second.ClearDirty();
+  }
+
+  // Hash of every key and value, the same whatever order the entries are in.
+  // Remembered while the section is clean, so sections are hashed once however
+  // often they are compared (see IniDiff), and ReadFile hashes them as it
+  // scans. Like the converted values of IniEntry, remembering it writes to
+  // the section, so it must not be called from several threads at once.
+  std::uint64_t GetContentHash() const;
+
+  allocator_type get_allocator() const
+  {
+    return m_SectionName.get_allocator();
+  }
+
+private:
+  friend class IniDiff;
+  friend class IniFile;
+  friend class IniSyntaxTree;
+
+  // Bytes of the source file holding the section, from the start of its
+  // header line to the end of its last entry line, and the content hash of
+  // the section those bytes hold
+  struct SourceRange
+  {
+    static constexpr std::size_t None = static_cast<std::size_t>(-1);
+
+    std::size_t   Begin = None;
+    std::size_t   End = None;
+    std::uint64_t Hash = 0;
+  };
+
+  // The content hash is a sum over keys and over values, so it can be built
+  // up a value at a time
+  static constexpr std::uint64_t ContentHashOfKey(std::uint64_t KeyHash)
+  {
+    return (KeyHash ^ (KeyHash >> 31)) * 0xD6E8FEB86659FD93ull;
+  }
+
+  static constexpr std::uint64_t ContentHashOfValue(std::uint64_t KeyHash, std::size_t Index, std::string_view Value)
+  {
+    const std::uint64_t Hash = (KeyHash + Index * 0x9E3779B97F4A7C15ull) ^ IniHashString(Value);
+    return (Hash ^ (Hash >> 29)) * 0x9E3779B97F4A7C15ull;
+  }
+
+  std::pmr::string      m_SectionName;
+  entry_map_t           m_Entries;
+  SourceRange           m_Source;
+  bool                  m_Dirty = true;
+  mutable std::uint64_t m_ContentHash = 0;
+  mutable bool          m_HasContentHash = false;
+};
+
+// IniFlatMap's vector moves its pairs when it grows only when moving cannot
+// throw, otherwise it copies every section, entry and value
+static_assert(std::is_nothrow_move_constructible_v<IniEntry>, "IniEntry must be nothrow move constructible");
+static_assert(std::is_nothrow_move_constructible_v<IniSection>, "IniSection must be nothrow move constructible");
+static_assert(std::is_nothrow_move_constructible_v<IniSection::entry_map_t::value_type>, "Entry pairs must be nothrow move constructible");
+static_assert(std::is_nothrow_move_constructible_v<std::pair<std::pmr::string, IniSection>>, "Section pairs must be nothrow move constructible");
+
+// A Section.Key path resolved once with IniFile::Resolve
+//
+// Holds the positions of the section and the entry, so reading through it is
+// two array indexes with no hashing. Adding sections and entries keeps it
+// valid. Removing or clearing anything in the file or the section moves
+// positions and bumps a generation, after which IniFile::TryGetEntry returns
+// std::nullopt for the handle until it is resolved again.
+class IniEntryHandle
+{
+public:
+  IniEntryHandle() = default;
+
+private:
+  friend class IniFile;
+
+  static constexpr std::uint32_t Unresolved = static_cast<std::uint32_t>(-1);
+
+  std::uint32_t m_SectionIndex = Unresolved;
+  std::uint32_t m_EntryIndex = Unresolved;
+  std::uint32_t m_SectionGeneration = 0;
+  std::uint32_t m_EntryGeneration = 0;
+};
+
+// Scanner parses in time linear in the size of the file, whatever the input.
+// Regex is kept for comparison only: std::regex_search retries the entry
+// pattern at every position of a line, so a long line with no '=' (a very
+// long key, for example) takes time quadratic in the line length. The two
+// read some malformed lines differently, see IniScanner.
+enum class IniParseMode
+{
+  Scanner,  // single pass character scanner (IniScanner)
+  Regex     // original std::regex based parser
+};
+
+class FrozenIni;
+
+// Not safe to use from several threads at once, lookups included, see
+// IniSharedSnapshot for a read-only view that threads can share
+class IniFile
+{
+public:
+  using allocator_type = std::pmr::polymorphic_allocator<char>;
+  using section_map_t = IniFlatMap<std::pmr::string, IniSection, IniStringHash, std::equal_to<>>;
+
+  IniFile() = default;
+
+  explicit IniFile(allocator_type Alloc)
+      : m_Sections(Alloc)
+  {}
+
+  IniFile(const std::string &FileName, IniParseMode ParseMode = IniParseMode::Scanner, IniReadMode ReadMode = IniReadMode::MappedSequential, allocator_type Alloc = {})
+      : m_Sections(Alloc)
+      , m_FileName(FileName)
+      , m_ParseMode(ParseMode)
+      , m_ReadMode(ReadMode)
+  {
+    if (!FileName.empty() && !ReadFile(FileName))
+      throw std::runtime_error("Failed to read ini file");
+  }
+
+  bool ReadFile(const std::string &FileName)
+  {
+    if (m_ParseMode == IniParseMode::Regex)
+    {
+      std::ifstream in(FileName, std::ios_base::in);
+      return ParseFile(in);
+    }
+
+    IniMappedFile Mapped;
+    if (!Mapped.Open(FileName, m_ReadMode))
+      return false;
+
+    ReadSource(FileName, Mapped.GetView());
+    return true;
+  }
+
+  // Parses ini text from any stream (std::cin, pipes, std::istringstream, ...)
+  bool ParseStream(std::istream &In, std::size_t BlockSize = IniScanner::DefaultBlockSize)
+  {
+    if (!In)
+      return false;
+
+    // Reading to the end sets eof and fail, bad means the read broke off
+    // partway and only part of the text was parsed
+    if (m_ParseMode == IniParseMode::Regex)
+      return ParseFile(In) && !In.bad();
+
+    IniScanner  Scanner;
+    ScanHandler Handler{*this};
+    Scanner.ScanStream(In, Handler, BlockSize);
+    return !In.bad();
+  }
+
+  // Parses ini text that is already in memory, using the same scanner as ReadFile
+  void ParseBuffer(std::string_view Buffer)
+  {
+    IniScanner  Scanner;
+    ScanHandler Handler{*this};
+    Scanner.Scan(Buffer, Handler);
+  }
+
+  // Writes every section, entry and list value back out as ini text, one
+  // "+Key=" line per extra value, so reading the result gives the same file.
+  // The text is built in one buffer and handed to the stream in one write.
+  // Returns false, and writes nothing, when a name, key or value cannot be
+  // written in this grammar: a key that is not [A-Za-z0-9_]+, a section name
+  // holding ']', or a value holding '#', ';' or a line end or ending in
+  // whitespace. Entries without values have nothing to write and are left out.
+  // WriteFile replaces the file through IniReplaceFile, a file that cannot be
+  // written in full is left as it was.
+  bool WriteTo(std::ostream &Out) const;
+  bool WriteFile(const std::string &FileName) const;
+
+  // Writes the file back to the file ReadFile read it from, re-serializing
+  // only the sections that are dirty and adding new ones at the end. A dirty
+  // section whose keys and values still hash the same as when it was read (a
+  // loop over non-const value iterators dirties without changing anything)
+  // is not rewritten. Every other byte, comments and blank lines included, is
+  // copied from the file as it was read. The result replaces the source
+  // through IniReplaceFile, so a symbolic link still points at the saved file
+  // and the file keeps its permissions.
+  //
+  // Returns false, and leaves the file alone, when there is no source (the
+  // file was not read by ReadFile or ReadCache in Scanner mode into an empty
+  // IniFile), the source changed size or modification time since it was
+  // read, or a dirty section cannot be written (see WriteTo). Afterwards
+  // everything is clean and the saved file is the new source.
+  bool SaveIncremental();
+
+  bool IsDirty() const
+  {
+    for (auto it = m_Sections.cbegin(); it != m_Sections.cend(); ++it)
+      if (it->second.IsDirty())
+        return true;
+
+    return false;
+  }
+
+  void ClearDirty()
+  {
+    for (auto it = m_Sections.begin(); it != m_Sections.end(); ++it)
+      it->second.ClearDirty();
+  }
+
+  // Binary cache of the parsed contents (see IniCache.cpp), so unchanged files
+  // skip the text parser at startup. The cache is stamped with the size,
+  // modification time and content hash of SourceFileName, ReadCache refuses a
+  // cache whose stamp no longer matches the file and loads nothing. WriteCache
+  // stamps it with the file as it is when the cache is written, so the
+  // contents must already match the file.
+  bool WriteCache(const std::string &SourceFileName, const std::string &CacheFileName) const;
+  bool ReadCache(const std::string &SourceFileName, const std::string &CacheFileName);
+
+  // ReadCache, falling back to ReadFile and rewriting the cache when it is
+  // missing or stale. The new cache is stamped from the bytes that were
+  // parsed, so a file edited while it is read gets a cache that is refused
+  // instead of one that holds the old contents under the new stamp.
+  bool ReadFileCached(const std::string &FileName, const std::string &CacheFileName);
+
+  bool HasSection(std::string_view SectionName) const
+  {
+    return (m_Sections.find(SectionName) != m_Sections.end());
+  }
+
+  std::optional<std::reference_wrapper<IniSection>> TryGetSection(std::string_view SectionName)
+  {
+    auto it = m_Sections.find(SectionName);
+    if (it == m_Sections.end())
+      return std::nullopt;
+
+    return std::make_optional(std::reference_wrapper<IniSection>(it->second));
+  }
+
+  bool HasSection(const IniHashedName &SectionName) const
+  {
+    return (m_Sections.find(SectionName.Name, SectionName.Hash) != m_Sections.end());
+  }
+
+  std::optional<std::reference_wrapper<IniSection>> TryGetSection(const IniHashedName &SectionName)
+  {
+    auto it = m_Sections.find(SectionName.Name, SectionName.Hash);
+    if (it == m_Sections.end())
+      return std::nullopt;
+
+    return std::make_optional(std::reference_wrapper<IniSection>(it->second));
+  }
+
+  // Section and entry lookup in one call, neither name is hashed at runtime
+  std::optional<std::reference_wrapper<IniEntry>> TryGetEntry(const IniKey &Key)
+  {
+    auto it = m_Sections.find(Key.Section.Name, Key.Section.Hash);
+    if (it == m_Sections.end())
+      return std::nullopt;
+
+    return it->second.TryGetEntry(Key.Entry);
+  }
+
+  // Looks the path up once, read it back with TryGetEntry(const IniEntryHandle &)
+  IniEntryHandle Resolve(std::string_view SectionName, std::string_view Key) const
+  {
+    return Resolve(m_Sections.find(SectionName), [&Key](const IniSection &Section) { return Section.m_Entries.find(Key); });
+  }
+
+  IniEntryHandle Resolve(const IniKey &Key) const
+  {
+    return Resolve(m_Sections.find(Key.Section.Name, Key.Section.Hash), [&Key](const IniSection &Section) { return Section.m_Entries.find(Key.Entry.Name, Key.Entry.Hash); });
+  }
+
+  bool IsValid(const IniEntryHandle &Handle) const
+  {
+    if (Handle.m_SectionGeneration != m_Sections.generation() || Handle.m_SectionIndex >= m_Sections.size())
+      return false;
+
+    const IniSection::entry_map_t &Entries = m_Sections.value_at(Handle.m_SectionIndex).second.m_Entries;
+    return (Handle.m_EntryGeneration == Entries.generation() && Handle.m_EntryIndex < Entries.size());
+  }
+
+  std::optional<std::reference_wrapper<IniEntry>> TryGetEntry(const IniEntryHandle &Handle)
+  {
+    if (!IsValid(Handle))
+      return std::nullopt;
+
+    IniSection &Section = m_Sections.value_at(Handle.m_SectionIndex).second;
+    return std::make_optional(std::reference_wrapper<IniEntry>(Section.m_Entries.value_at(Handle.m_EntryIndex).second));
+  }
+
+  // Compiles the file into an immutable FrozenIni (see FrozenIni.h) with a
+  // perfect hash over every section and Section.Key pair
+  FrozenIni Freeze() const;
+
+private:
+  using section_iterator_t = typename section_map_t::iterator;
+  using section_const_iterator_t = typename section_map_t::const_iterator;
+
+public:
+  section_iterator_t begin()
+  {
+    return m_Sections.begin();
+  }
+
+  section_iterator_t end()
+  {
+    return m_Sections.end();
+  }
+
+  section_const_iterator_t cbegin() const
+  {
+    return m_Sections.cbegin();
+  }
+
+  section_const_iterator_t cend() const
+  {
+    return m_Sections.cend();
+  }
+
+  const std::string &GetFileName() const
+  {
+    return m_FileName;
+  }
+
+  IniParseMode GetParseMode() const
+  {
+    return m_ParseMode;
+  }
+
+  IniReadMode GetReadMode() const
+  {
+    return m_ReadMode;
+  }
+
+  allocator_type get_allocator() const
+  {
+    return m_Sections.get_allocator();
+  }
+
+private:
+  // Builds its IniFile with ScanHandler and edits sections in place
+  friend class IniSyntaxTree;
+
+  // Compares the section maps of two files without the non-const lookups
+  friend class IniDiff;
+
+  bool WriteText(std::string &Buffer) const;
+
+  template<class FindEntry>
+  IniEntryHandle Resolve(section_const_iterator_t SectionIt, FindEntry &&FindInSection) const
+  {
+    IniEntryHandle Handle;
+    if (SectionIt == m_Sections.cend())
+      return Handle;
+
+    const IniSection::entry_map_t &Entries = SectionIt->second.m_Entries;
+
+    auto EntryIt = FindInSection(SectionIt->second);
+    if (EntryIt == Entries.cend())
+      return Handle;
+
+    Handle.m_SectionIndex = static_cast<std::uint32_t>(m_Sections.index_of(SectionIt));
+    Handle.m_EntryIndex = static_cast<std::uint32_t>(Entries.index_of(EntryIt));
+    Handle.m_SectionGeneration = m_Sections.generation();
+    Handle.m_EntryGeneration = Entries.generation();
+    return Handle;
+  }
+
+  struct ScanHandler
+  {
+    IniFile &   File;
+    IniSection *Section = nullptr;
+
+    // Set while reading the source file, names and values are views into it
+    const char *SourceBegin = nullptr;
+    const char *SourceEnd = nullptr;
+
+    void OnSection(std::string_view Name)
+    {
+      // The first block for a section wins, same as the regex parser
+      auto Res = File.m_Sections.try_emplace(Name, Name);
+      Section = Res.second ? &Res.first->second : nullptr;
+
+      if (Section && SourceBegin)
+      {
+        const char *LineBegin = Name.data();
+        while (LineBegin > SourceBegin && LineBegin[-1] != '\n')
+          --LineBegin;
+
+        Section->m_Source.Begin = static_cast<std::size_t>(LineBegin - SourceBegin);
+        Section->m_Source.End = LineEndOffset(Name);
+      }
+    }
+
+    void OnEntry(std::string_view Key, std::string_view Value, bool)
+    {
+      if (!Section)
+        return;
+
+      IniEntry &Entry = (*Section)[Key];
+
+      if (SourceBegin)
+      {
+        Section->m_Source.End = LineEndOffset(Value);
+
+        const std::uint64_t KeyHash = IniHashString(Key);
+        if (Entry.GetValueCount() == 0)
+          Section->m_ContentHash += IniSection::ContentHashOfKey(KeyHash);
+
+        Section->m_ContentHash += IniSection::ContentHashOfValue(KeyHash, Entry.GetValueCount(), Value);
+      }
+
+      Entry.AddValue(Value);
+    }
+
+    // Offset just past the line holding Text, its '\n' included
+    std::size_t LineEndOffset(std::string_view Text) const
+    {
+      const char *After = Text.data() + Text.size();
+      const char *NewLine = static_cast<const char *>(std::memchr(After, '\n', static_cast<std::size_t>(SourceEnd - After)));
+      return static_cast<std::size_t>((NewLine ? NewLine + 1 : SourceEnd) - SourceBegin);
+    }
+  };
+
+  // The file ReadFile read, stamped with its size and modification time as
+  // it was when read or last saved
+  struct SourceFile
+  {
+    std::string  FileName;
+    std::size_t  Size = 0;
+    std::int64_t Modified = 0;
+  };
+
+  // Makes FileName the source of SaveIncremental, or clears the source when
+  // it cannot be stamped
+  void StampSource(const std::string &FileName);
+
+  // Scans Source, the contents of FileName, the way ReadFile does
+  void ReadSource(const std::string &FileName, std::string_view Source)
+  {
+    // A file read into an empty IniFile is its source, SaveIncremental splices
+    // changes back into it
+    if (!m_Sections.empty())
+    {
+      ParseBuffer(Source);
+      return;
+    }
+
+    IniScanner  Scanner;
+    ScanHandler Handler{*this};
+    Handler.SourceBegin = Source.data();
+    Handler.SourceEnd = Source.data() + Source.size();
+    Scanner.Scan(Source, Handler);
+
+    StampSource(FileName);
+    ClearDirty();
+
+    // The handler hashed every section as it went
+    for (auto it = m_Sections.begin(); it != m_Sections.end(); ++it)
+    {
+      it->second.m_HasContentHash = true;
+      it->second.m_Source.Hash = it->second.m_ContentHash;
+    }
+  }
+
+  // Writes the cache of the contents, stamped with the source text they were
+  // parsed from. HasSourceRanges says the sections' source ranges describe
+  // that text, so a load can make it the source of SaveIncremental.
+  bool WriteCacheFile(const std::string &CacheFileName, std::uint64_t SourceSize, std::int64_t SourceModified, std::uint64_t SourceHash, bool HasSourceRanges) const;
+
+  bool ParseFile(std::istream &InFile)
+  {
+    if (!InFile)
+      return false;
+
+    std::string CurrentLine;
+
+    while (InFile && std::getline(InFile, CurrentLine))
+    {
+      if (!CurrentLine.empty() && CurrentLine.back() == '\r')
+        CurrentLine.pop_back();
+
+      if (CurrentLine.empty() || CurrentLine.front() == '\n' || CurrentLine.front() == '#' || CurrentLine.front() == ';')
+        continue;
+
+      std::smatch Match;
+      if (std::regex_search(CurrentLine, Match, SectionHeaderRegex))
+      {
+        IniSection Section(Match[1].str(), get_allocator());
+        ParseSection(Section, InFile);
+        m_Sections.emplace(Section.GetName(), std::move(Section));
+      }
+    }
+
+    return true;
+  }
+
+  void ParseSection(IniSection &Section, std::istream &InFile)
+  {
+    std::string CurrentLine;
+    std::smatch Match;
+
+    auto TrimWhitespaceFromEnd = [](std::string &ToTrim) {
+      ToTrim.erase(std::find_if(ToTrim.rbegin(), ToTrim.rend(), [](int ch) { return !std::isspace(ch); }).base(), ToTrim.end());
+    };
+
+    // Without text mode translation, lines from CRLF files still end in '\r'
+    auto ReadLine = [&InFile](std::string &Line) {
+      if (!std::getline(InFile, Line))
+        return false;
+      if (!Line.empty() && Line.back() == '\r')
+        Line.pop_back();
+      return true;
+    };
+
+    while (InFile && ReadLine(CurrentLine) && !CurrentLine.empty() && (CurrentLine.front() != '\n'))
+    {
+      if (std::regex_search(CurrentLine, Match, EntryRegex))
+      {
+        std::string ValueString(Match[2]);
+        TrimWhitespaceFromEnd(ValueString);
+
+        if (CurrentLine.front() == '+')
+        {
+          Section[Match[1].str()].AddValue(ValueString);
+        }
+        else
+        {
+          Section.CreateEntry(Match[1].str()).AddValue(ValueString);
+        }
+      }
+    }
+  }
+
+  section_map_t m_Sections;
+  SourceFile    m_Source;
+  std::string   m_FileName;
+  IniParseMode  m_ParseMode = IniParseMode::Scanner;
+  IniReadMode   m_ReadMode = IniReadMode::MappedSequential;
+
+  static const std::regex SectionHeaderRegex;
+  static const std::regex EntryRegex;
+};
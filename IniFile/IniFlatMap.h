@@ -0,0 +1,560 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template<class T, class = void>
+struct IniIsTransparent : std::false_type
+{};
+
+template<class T>
+struct IniIsTransparent<T, std::void_t<typename T::is_transparent>> : std::true_type
+{};
+
+// Open addressing hash map used for IniFile's sections and IniSection's entries
+//
+// The key/value pairs are stored densely in insertion order in a vector, so
+// iteration is a linear walk. The hash table itself only holds 8-byte buckets:
+// the index of the pair and a probe distance packed with 8 bits of the hash,
+// so most misses are rejected without touching the pairs. Collisions are
+// resolved with Robin Hood linear probing and erasure uses backward shifting,
+// no tombstones are left behind.
+//
+// Unlike std::unordered_map, inserting can move the pairs when the vector
+// grows, and erasing moves the last pair into the erased slot, so both
+// invalidate iterators, pointers and references into the map.
+//
+// Inserting keeps the index of every pair, so pairs can also be addressed by
+// position (index_of, value_at). generation() changes whenever positions may
+// have changed, which is on erase, clear and assignment.
+//
+// When both Hash and KeyEqual define is_transparent, find, count, at, erase
+// and try_emplace accept any key type they can hash and compare, the same as
+// the C++20 heterogeneous lookup of std::unordered_map. find can also be given
+// a hash computed ahead of time, at compile time for constexpr hashers.
+template<class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class IniFlatMap
+{
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<Key, T>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = std::pmr::polymorphic_allocator<value_type>;
+
+private:
+  using values_t = std::pmr::vector<value_type>;
+
+  // A template on K, so the overloads using it drop out for other maps
+  template<class K>
+  static constexpr bool is_transparent_v = IniIsTransparent<Hash>::value && IniIsTransparent<KeyEqual>::value;
+
+  template<class K>
+  using if_transparent_t = std::enable_if_t<is_transparent_v<K>>;
+
+public:
+  using iterator = typename values_t::iterator;
+  using const_iterator = typename values_t::const_iterator;
+
+  IniFlatMap() = default;
+
+  explicit IniFlatMap(const allocator_type &Alloc)
+      : m_Values(Alloc)
+      , m_Buckets(Alloc)
+  {}
+
+  IniFlatMap(const IniFlatMap &) = default;
+
+  // Moving keeps every position, so the generation goes along with the pairs
+  // and positions taken before the move stay valid
+  IniFlatMap(IniFlatMap &&Other) noexcept
+      : m_Values(std::move(Other.m_Values))
+      , m_Buckets(std::move(Other.m_Buckets))
+      , m_Shift(Other.m_Shift)
+      , m_Generation(Other.m_Generation)
+  {
+    Other.clear();
+  }
+
+  IniFlatMap(const IniFlatMap &Other, const allocator_type &Alloc)
+      : m_Values(Other.m_Values, Alloc)
+      , m_Buckets(Other.m_Buckets, Alloc)
+      , m_Shift(Other.m_Shift)
+  {}
+
+  IniFlatMap(IniFlatMap &&Other, const allocator_type &Alloc)
+      : m_Values(std::move(Other.m_Values), Alloc)
+      , m_Buckets(std::move(Other.m_Buckets), Alloc)
+      , m_Shift(Other.m_Shift)
+      , m_Generation(Other.m_Generation)
+  {
+    Other.clear();
+  }
+
+  IniFlatMap &operator=(const IniFlatMap &Other)
+  {
+    m_Values = Other.m_Values;
+    m_Buckets = Other.m_Buckets;
+    m_Shift = Other.m_Shift;
+    ++m_Generation;
+    return *this;
+  }
+
+  // Between maps on different memory resources the pairs are moved one at a
+  // time, running out of memory there terminates
+  IniFlatMap &operator=(IniFlatMap &&Other) noexcept
+  {
+    m_Values = std::move(Other.m_Values);
+    m_Buckets = std::move(Other.m_Buckets);
+    m_Shift = Other.m_Shift;
+    ++m_Generation;
+    Other.clear();
+    return *this;
+  }
+
+  allocator_type get_allocator() const
+  {
+    return m_Values.get_allocator();
+  }
+
+  hasher hash_function() const
+  {
+    return Hash{};
+  }
+
+  iterator begin()
+  {
+    return m_Values.begin();
+  }
+
+  iterator end()
+  {
+    return m_Values.end();
+  }
+
+  const_iterator begin() const
+  {
+    return m_Values.begin();
+  }
+
+  const_iterator end() const
+  {
+    return m_Values.end();
+  }
+
+  const_iterator cbegin() const
+  {
+    return m_Values.cbegin();
+  }
+
+  const_iterator cend() const
+  {
+    return m_Values.cend();
+  }
+
+  bool empty() const
+  {
+    return m_Values.empty();
+  }
+
+  size_type size() const
+  {
+    return m_Values.size();
+  }
+
+  size_type index_of(const_iterator Position) const
+  {
+    return static_cast<size_type>(Position - m_Values.cbegin());
+  }
+
+  value_type &value_at(size_type Index)
+  {
+    return m_Values[Index];
+  }
+
+  const value_type &value_at(size_type Index) const
+  {
+    return m_Values[Index];
+  }
+
+  std::uint32_t generation() const
+  {
+    return m_Generation;
+  }
+
+  size_type bucket_count() const
+  {
+    return m_Buckets.size();
+  }
+
+  float load_factor() const
+  {
+    return m_Buckets.empty() ? 0.0f : static_cast<float>(m_Values.size()) / static_cast<float>(m_Buckets.size());
+  }
+
+  void clear()
+  {
+    m_Values.clear();
+    m_Buckets.clear();
+    m_Shift = InitialShift;
+    ++m_Generation;
+  }
+
+  void reserve(size_type Count)
+  {
+    m_Values.reserve(Count);
+
+    if (Count > MaxLoad(m_Buckets.size()))
+    {
+      std::uint8_t Shift = InitialShift;
+      while (Count > MaxLoad(BucketCountFor(Shift)))
+        --Shift;
+
+      Rehash(Shift);
+    }
+  }
+
+  iterator find(const Key &ToFind)
+  {
+    const size_type Index = FindIndex(ToFind);
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  const_iterator find(const Key &ToFind) const
+  {
+    const size_type Index = FindIndex(ToFind);
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  size_type count(const Key &ToFind) const
+  {
+    return FindIndex(ToFind) == NotFound ? 0 : 1;
+  }
+
+  T &at(const Key &ToFind)
+  {
+    const size_type Index = FindIndex(ToFind);
+    if (Index == NotFound)
+      throw std::out_of_range("IniFlatMap::at");
+
+    return m_Values[Index].second;
+  }
+
+  const T &at(const Key &ToFind) const
+  {
+    const size_type Index = FindIndex(ToFind);
+    if (Index == NotFound)
+      throw std::out_of_range("IniFlatMap::at");
+
+    return m_Values[Index].second;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  iterator find(const K &ToFind)
+  {
+    const size_type Index = FindIndex(ToFind);
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  const_iterator find(const K &ToFind) const
+  {
+    const size_type Index = FindIndex(ToFind);
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  // HashValue has to be hash_function()(ToFind), the key is not hashed again
+  template<class K>
+  iterator find(const K &ToFind, std::size_t HashValue)
+  {
+    const size_type Index = FindIndex(ToFind, MixHash(HashValue));
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  template<class K>
+  const_iterator find(const K &ToFind, std::size_t HashValue) const
+  {
+    const size_type Index = FindIndex(ToFind, MixHash(HashValue));
+    return Index == NotFound ? m_Values.end() : m_Values.begin() + Index;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  size_type count(const K &ToFind) const
+  {
+    return FindIndex(ToFind) == NotFound ? 0 : 1;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  T &at(const K &ToFind)
+  {
+    const size_type Index = FindIndex(ToFind);
+    if (Index == NotFound)
+      throw std::out_of_range("IniFlatMap::at");
+
+    return m_Values[Index].second;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  const T &at(const K &ToFind) const
+  {
+    const size_type Index = FindIndex(ToFind);
+    if (Index == NotFound)
+      throw std::out_of_range("IniFlatMap::at");
+
+    return m_Values[Index].second;
+  }
+
+  template<class K, class... Args>
+  std::pair<iterator, bool> try_emplace(K &&NewKey, Args &&... args)
+  {
+    const std::uint64_t HashValue = HashKey(NewKey);
+
+    const size_type Found = FindIndex(NewKey, HashValue);
+    if (Found != NotFound)
+      return {m_Values.begin() + Found, false};
+
+    if (m_Values.size() + 1 > MaxLoad(m_Buckets.size()))
+      Rehash(static_cast<std::uint8_t>(m_Shift - (m_Buckets.empty() ? 0 : 1)));
+
+    m_Values.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(NewKey)), std::forward_as_tuple(std::forward<Args>(args)...));
+    PlaceBucket(HashValue, static_cast<std::uint32_t>(m_Values.size() - 1));
+
+    return {std::prev(m_Values.end()), true};
+  }
+
+  template<class K, class V>
+  std::pair<iterator, bool> emplace(K &&NewKey, V &&Value)
+  {
+    return try_emplace(std::forward<K>(NewKey), std::forward<V>(Value));
+  }
+
+  iterator erase(iterator Position)
+  {
+    return erase(const_iterator(Position));
+  }
+
+  iterator erase(const_iterator Position)
+  {
+    const size_type Index = index_of(Position);
+
+    ++m_Generation;
+    EraseBucket(BucketOf(Index));
+
+    // Fill the hole with the last pair so the values stay dense
+    const size_type Last = m_Values.size() - 1;
+    if (Index != Last)
+    {
+      m_Buckets[BucketOf(Last)].ValueIndex = static_cast<std::uint32_t>(Index);
+      m_Values[Index] = std::move(m_Values[Last]);
+    }
+
+    m_Values.pop_back();
+    return m_Values.begin() + Index;
+  }
+
+  size_type erase(const Key &ToErase)
+  {
+    const size_type Index = FindIndex(ToErase);
+    if (Index == NotFound)
+      return 0;
+
+    erase(m_Values.cbegin() + Index);
+    return 1;
+  }
+
+  template<class K, class = if_transparent_t<K>>
+  size_type erase(const K &ToErase)
+  {
+    const size_type Index = FindIndex(ToErase);
+    if (Index == NotFound)
+      return 0;
+
+    erase(m_Values.cbegin() + Index);
+    return 1;
+  }
+
+private:
+  struct Bucket
+  {
+    // Probe distance + 1 in the upper 24 bits, 0 for an empty bucket, and the
+    // low 8 bits of the hash in the lower 8
+    std::uint32_t DistAndFingerprint = 0;
+    std::uint32_t ValueIndex = 0;
+  };
+
+  static constexpr std::uint32_t DistInc = 1u << 8;
+  static constexpr std::uint32_t FingerprintMask = DistInc - 1;
+  static constexpr std::uint8_t  InitialShift = 64 - 3;  // 8 buckets
+  static constexpr size_type     NotFound = static_cast<size_type>(-1);
+
+  static size_type BucketCountFor(std::uint8_t Shift)
+  {
+    return size_type(1) << (64 - Shift);
+  }
+
+  // Keeps the table at most 80% full
+  static size_type MaxLoad(size_type BucketCount)
+  {
+    return BucketCount / 5 * 4;
+  }
+
+  template<class K>
+  std::uint64_t HashKey(const K &ToHash) const
+  {
+    return MixHash(Hash{}(ToHash));
+  }
+
+  // Spread the bits with a multiplicative mix, std::hash can be the identity
+  static std::uint64_t MixHash(std::size_t HashValue)
+  {
+    return static_cast<std::uint64_t>(HashValue) * 0x9E3779B97F4A7C15ull;
+  }
+
+  std::uint32_t FingerprintOf(std::uint64_t HashValue) const
+  {
+    return static_cast<std::uint32_t>(HashValue) & FingerprintMask;
+  }
+
+  size_type HomeBucket(std::uint64_t HashValue) const
+  {
+    return static_cast<size_type>(HashValue >> m_Shift);
+  }
+
+  size_type NextBucket(size_type BucketIndex) const
+  {
+    return (BucketIndex + 1) & (m_Buckets.size() - 1);
+  }
+
+  template<class K>
+  size_type FindIndex(const K &ToFind) const
+  {
+    if (m_Values.empty())
+      return NotFound;
+
+    return FindIndex(ToFind, HashKey(ToFind));
+  }
+
+  template<class K>
+  size_type FindIndex(const K &ToFind, std::uint64_t HashValue) const
+  {
+    if (m_Buckets.empty())
+      return NotFound;
+
+    std::uint32_t DistAndFingerprint = DistInc | FingerprintOf(HashValue);
+    size_type     BucketIndex = HomeBucket(HashValue);
+
+    // Robin Hood ordering lets the probe stop as soon as it meets an entry
+    // closer to its home than the key would be
+    while (DistAndFingerprint <= m_Buckets[BucketIndex].DistAndFingerprint)
+    {
+      const Bucket &Current = m_Buckets[BucketIndex];
+      if (Current.DistAndFingerprint == DistAndFingerprint && KeyEqual{}(m_Values[Current.ValueIndex].first, ToFind))
+        return Current.ValueIndex;
+
+      DistAndFingerprint += DistInc;
+      BucketIndex = NextBucket(BucketIndex);
+    }
+
+    return NotFound;
+  }
+
+  // Finds the bucket that refers to the pair at ValueIndex
+  size_type BucketOf(size_type ValueIndex) const
+  {
+    size_type BucketIndex = HomeBucket(HashKey(m_Values[ValueIndex].first));
+
+    while (m_Buckets[BucketIndex].ValueIndex != ValueIndex)
+      BucketIndex = NextBucket(BucketIndex);
+
+    return BucketIndex;
+  }
+
+  void PlaceBucket(std::uint64_t HashValue, std::uint32_t ValueIndex)
+  {
+    Bucket    ToPlace{DistInc | FingerprintOf(HashValue), ValueIndex};
+    size_type BucketIndex = HomeBucket(HashValue);
+
+    // Take the slot of any entry that is closer to its home, then carry that
+    // entry forward instead
+    while (m_Buckets[BucketIndex].DistAndFingerprint != 0)
+    {
+      if (ToPlace.DistAndFingerprint > m_Buckets[BucketIndex].DistAndFingerprint)
+        std::swap(ToPlace, m_Buckets[BucketIndex]);
+
+      ToPlace.DistAndFingerprint += DistInc;
+      BucketIndex = NextBucket(BucketIndex);
+    }
+
+    m_Buckets[BucketIndex] = ToPlace;
+  }
+
+  void EraseBucket(size_type BucketIndex)
+  {
+    size_type Next = NextBucket(BucketIndex);
+
+    while (m_Buckets[Next].DistAndFingerprint >= 2 * DistInc)
+    {
+      m_Buckets[BucketIndex] = {m_Buckets[Next].DistAndFingerprint - DistInc, m_Buckets[Next].ValueIndex};
+      BucketIndex = Next;
+      Next = NextBucket(Next);
+    }
+
+    m_Buckets[BucketIndex] = {};
+  }
+
+  void Rehash(std::uint8_t NewShift)
+  {
+    m_Shift = NewShift;
+    m_Buckets.assign(BucketCountFor(NewShift), Bucket{});
+
+    // Grow the pairs in step with the table instead of from a single element
+    m_Values.reserve(MaxLoad(m_Buckets.size()));
+
+    for (size_type i = 0; i < m_Values.size(); ++i)
+      PlaceBucket(HashKey(m_Values[i].first), static_cast<std::uint32_t>(i));
+  }
+
+  values_t                 m_Values;
+  std::pmr::vector<Bucket> m_Buckets;
+  std::uint8_t             m_Shift = InitialShift;
+  std::uint32_t            m_Generation = 0;
+};
@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniMappedFile.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define INIFILE_HAS_MMAP 1
+#  include <cerrno>
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#else
+#  define INIFILE_HAS_MMAP 0
+#  include <iterator>
+#  include <random>
+#endif
+
+IniMappedFile::IniMappedFile(IniMappedFile &&Other) noexcept
+    : m_Mapping(std::exchange(Other.m_Mapping, nullptr))
+    , m_MappedSize(std::exchange(Other.m_MappedSize, 0))
+    , m_Buffer(std::move(Other.m_Buffer))
+{
+}
+
+IniMappedFile::~IniMappedFile()
+{
+  Close();
+}
+
+IniMappedFile &IniMappedFile::operator=(IniMappedFile &&Other) noexcept
+{
+  if (this != &Other)
+  {
+    Close();
+    m_Mapping = std::exchange(Other.m_Mapping, nullptr);
+    m_MappedSize = std::exchange(Other.m_MappedSize, 0);
+    m_Buffer = std::move(Other.m_Buffer);
+  }
+
+  return *this;
+}
+
+#if INIFILE_HAS_MMAP
+
+bool IniMappedFile::Open(const std::string &FileName, IniReadMode Mode)
+{
+  Close();
+
+  const int FileDescriptor = ::open(FileName.c_str(), O_RDONLY | O_CLOEXEC);
+  if (FileDescriptor < 0)
+    return false;
+
+  struct stat Info;
+  if (::fstat(FileDescriptor, &Info) != 0)
+  {
+    ::close(FileDescriptor);
+    return false;
+  }
+
+  const bool        IsRegular = S_ISREG(Info.st_mode);
+  const std::size_t Size = IsRegular ? static_cast<std::size_t>(Info.st_size) : 0;
+
+  if (Mode != IniReadMode::Buffered && Size > 0)
+  {
+    int Flags = MAP_PRIVATE;
+#  ifdef MAP_POPULATE
+    if (Mode == IniReadMode::MappedPopulate)
+      Flags |= MAP_POPULATE;
+#  endif
+
+    void *Mapping = ::mmap(nullptr, Size, PROT_READ, Flags, FileDescriptor, 0);
+    if (Mapping != MAP_FAILED)
+    {
+      if (Mode == IniReadMode::MappedSequential)
+        ::madvise(Mapping, Size, MADV_SEQUENTIAL);
+
+      m_Mapping = Mapping;
+      m_MappedSize = Size;
+      ::close(FileDescriptor);
+      return true;
+    }
+  }
+
+  const bool Result = ReadAll(FileDescriptor, Size);
+  ::close(FileDescriptor);
+  return Result;
+}
+
+void IniMappedFile::Close()
+{
+  if (m_Mapping)
+    ::munmap(m_Mapping, m_MappedSize);
+
+  m_Mapping = nullptr;
+  m_MappedSize = 0;
+  m_Buffer = std::vector<char>();
+}
+
+bool IniMappedFile::ReadAll(int FileDescriptor, std::size_t SizeHint)
+{
+  // Regular files are read in one go, anything else in 64 KB steps until EOF
+  std::size_t Used = 0;
+  m_Buffer.resize(SizeHint > 0 ? SizeHint + 1 : 64 * 1024);
+
+  for (;;)
+  {
+    if (Used == m_Buffer.size())
+      m_Buffer.resize(m_Buffer.size() * 2);
+
+    const ssize_t Count = ::read(FileDescriptor, m_Buffer.data() + Used, m_Buffer.size() - Used);
+    if (Count == 0)
+      break;
+
+    if (Count < 0)
+    {
+      if (errno == EINTR)
+        continue;
+
+      m_Buffer.clear();
+      return false;
+    }
+
+    Used += static_cast<std::size_t>(Count);
+  }
+
+  m_Buffer.resize(Used);
+  return true;
+}
+
+#else
+
+bool IniMappedFile::Open(const std::string &FileName, IniReadMode)
+{
+  Close();
+
+  std::ifstream In(FileName, std::ios_base::in | std::ios_base::binary);
+  if (!In)
+    return false;
+
+  m_Buffer.assign(std::istreambuf_iterator<char>(In), std::istreambuf_iterator<char>());
+  return true;
+}
+
+void IniMappedFile::Close()
+{
+  m_Buffer = std::vector<char>();
+}
+
+bool IniMappedFile::ReadAll(int, std::size_t)
+{
+  return false;
+}
+
+#endif
+
+std::string_view IniMappedFile::GetView() const
+{
+  if (m_Mapping)
+    return std::string_view(static_cast<const char *>(m_Mapping), m_MappedSize);
+
+  return std::string_view(m_Buffer.data(), m_Buffer.size());
+}
+
+bool IniMappedFile::IsMapped() const
+{
+  return m_Mapping != nullptr;
+}
+
+namespace
+{
+  bool WriteInPlace(const std::string &FileName, std::string_view Contents)
+  {
+    std::ofstream File(FileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    File.write(Contents.data(), static_cast<std::streamsize>(Contents.size()));
+
+    // Most write errors only show up when the last of the text is flushed
+    File.close();
+    return !File.fail();
+  }
+
+  std::atomic<unsigned> TempFileCounter{0};
+
+#if INIFILE_HAS_MMAP
+
+  // Creates a file no one else has opened (O_EXCL) and writes Contents to it
+  bool WriteNewFile(const std::string &Target, std::string_view Contents, const std::filesystem::file_status &TargetStatus, std::string &TempFileName)
+  {
+    int FileDescriptor = -1;
+    for (int Attempt = 0; Attempt < 100 && FileDescriptor < 0; ++Attempt)
+    {
+      TempFileName = Target + "." + std::to_string(::getpid()) + "." + std::to_string(TempFileCounter++) + ".tmp";
+      FileDescriptor = ::open(TempFileName.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+      if (FileDescriptor < 0 && errno != EEXIST)
+        break;
+    }
+
+    if (FileDescriptor < 0)
+    {
+      TempFileName.clear();
+      return false;
+    }
+
+    bool Written = true;
+    if (std::filesystem::exists(TargetStatus))
+      Written = (::fchmod(FileDescriptor, static_cast<mode_t>(TargetStatus.permissions() & std::filesystem::perms::mask)) == 0);
+
+    for (std::size_t Done = 0; Written && Done < Contents.size();)
+    {
+      const ssize_t Count = ::write(FileDescriptor, Contents.data() + Done, Contents.size() - Done);
+      if (Count < 0 && errno == EINTR)
+        continue;
+
+      Written = (Count > 0);
+      Done += Written ? static_cast<std::size_t>(Count) : 0;
+    }
+
+    return (::close(FileDescriptor) == 0) && Written;
+  }
+
+#else
+
+  bool WriteNewFile(const std::string &Target, std::string_view Contents, const std::filesystem::file_status &TargetStatus, std::string &TempFileName)
+  {
+    static const unsigned Process = std::random_device()();
+
+    std::error_code Error;
+    for (int Attempt = 0; Attempt < 100; ++Attempt)
+    {
+      TempFileName = Target + "." + std::to_string(Process) + "." + std::to_string(TempFileCounter++) + ".tmp";
+      if (!std::filesystem::exists(TempFileName, Error))
+        break;
+    }
+
+    if (!WriteInPlace(TempFileName, Contents))
+      return false;
+
+    if (std::filesystem::exists(TargetStatus))
+      std::filesystem::permissions(TempFileName, TargetStatus.permissions(), Error);
+
+    return !Error;
+  }
+
+#endif
+}  // namespace
+
+bool IniReplaceFile(const std::string &FileName, std::string_view Contents)
+{
+  std::error_code Error;
+  const auto      LinkStatus = std::filesystem::symlink_status(FileName, Error);
+  const auto      Status = std::filesystem::status(FileName, Error);
+
+  // Devices and pipes cannot be renamed over, and a link to nothing has no
+  // directory to put the new file in
+  if (std::filesystem::exists(Status) ? !std::filesystem::is_regular_file(Status) : std::filesystem::is_symlink(LinkStatus))
+    return WriteInPlace(FileName, Contents);
+
+  std::string Target = FileName;
+  if (std::filesystem::is_symlink(LinkStatus))
+  {
+    Target = std::filesystem::canonical(FileName, Error).string();
+    if (Error)
+      return false;
+  }
+
+  std::string TempFileName;
+  const bool  Written = WriteNewFile(Target, Contents, Status, TempFileName);
+
+  if (Written)
+    std::filesystem::rename(TempFileName, Target, Error);
+
+  if (!Written || Error)
+  {
+    if (!TempFileName.empty())
+      std::filesystem::remove(TempFileName, Error);
+    return false;
+  }
+
+  return true;
+}
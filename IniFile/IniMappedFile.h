@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class IniReadMode
+{
+  Buffered,          // read the whole file into an owned buffer
+  Mapped,            // mmap the file with default paging
+  MappedSequential,  // mmap and advise the kernel the pages are read in order
+  MappedPopulate     // mmap with MAP_POPULATE, pre-faulting every page up front
+};
+
+// Read-only view over the whole contents of a file
+//
+// Regular files are memory mapped where mmap is available so they can be parsed
+// straight out of the mapped pages. Pipes, character devices, files that report
+// a size of 0 (like most of /proc) and anything mmap refuses fall back to being
+// read into an owned buffer. Platforms without mmap always use the buffer.
+class IniMappedFile
+{
+public:
+  IniMappedFile() = default;
+  IniMappedFile(const IniMappedFile &) = delete;
+  IniMappedFile(IniMappedFile &&Other) noexcept;
+  ~IniMappedFile();
+
+  IniMappedFile &operator=(const IniMappedFile &) = delete;
+  IniMappedFile &operator=(IniMappedFile &&Other) noexcept;
+
+  bool             Open(const std::string &FileName, IniReadMode Mode = IniReadMode::MappedSequential);
+  void             Close();
+  std::string_view GetView() const;
+  bool             IsMapped() const;
+
+private:
+  bool ReadAll(int FileDescriptor, std::size_t SizeHint);
+
+  void *            m_Mapping = nullptr;
+  std::size_t       m_MappedSize = 0;
+  std::vector<char> m_Buffer;  // a vector keeps its data pointer when moved, views stay valid
+};
+
+// Replaces the contents of FileName without a reader ever seeing half of them.
+// The text is written to a uniquely named file next to it, closed, checked and
+// renamed over FileName, so concurrent saves never share a temporary file. A
+// symbolic link is followed and its target replaced, and the file keeps its
+// permissions. Anything that is not a regular file (a device, a pipe, a link
+// to nothing) is written in place instead. Returns false when any step fails,
+// a renamed file is then left as it was.
+bool IniReplaceFile(const std::string &FileName, std::string_view Contents);
@@ -0,0 +1,332 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Character classes used by IniScanner, indexed by unsigned char
+namespace IniCharClass
+{
+  enum : std::uint8_t
+  {
+    Word    = 1 << 0,  // [A-Za-z0-9_], same set as \w in the regex parser
+    Space   = 1 << 1,  // same set as std::isspace in the "C" locale
+    Comment = 1 << 2,  // '#' or ';'
+    LineEnd = 1 << 3   // '\r' or '\n'
+  };
+
+  constexpr std::array<std::uint8_t, 256> MakeTable()
+  {
+    std::array<std::uint8_t, 256> Table{};
+
+    for (int c = 'a'; c <= 'z'; ++c)
+      Table[c] |= Word;
+    for (int c = 'A'; c <= 'Z'; ++c)
+      Table[c] |= Word;
+    for (int c = '0'; c <= '9'; ++c)
+      Table[c] |= Word;
+    Table['_'] |= Word;
+
+    Table[' '] |= Space;
+    Table['\t'] |= Space;
+    Table['\v'] |= Space;
+    Table['\f'] |= Space;
+    Table['\r'] |= Space | LineEnd;
+    Table['\n'] |= Space | LineEnd;
+
+    Table['#'] |= Comment;
+    Table[';'] |= Comment;
+
+    return Table;
+  }
+
+  inline constexpr std::array<std::uint8_t, 256> Table = MakeTable();
+
+  inline bool Is(char c, std::uint8_t Class)
+  {
+    return (Table[static_cast<unsigned char>(c)] & Class) != 0;
+  }
+}  // namespace IniCharClass
+
+// Single-pass, regex-free scanner for ini text
+//
+// Recognizes this grammar, one line at a time:
+//   [Name]          section header (anything after the first ']' is ignored)
+//   Key=Value       entry, value runs up to the first '#', ';' or line end
+//   +Key=Value      append to the list of values for Key
+//   # or ; ...      comment line
+// Lines may be indented with spaces and tabs. A blank line ends the current
+// section, and entries are only reported while inside a section. Every byte
+// is looked at a bounded number of times, so a scan is linear in the size of
+// the input.
+//
+// The regex based parser in IniFile (IniParseMode::Regex) searches each line
+// for its patterns instead of matching the line as a whole, so it reads some
+// lines differently (see Tests/Scanner.cpp):
+//   - A line of only whitespace ends a section here, the regex parser only
+//     ends one at an empty line.
+//   - A key has to start the line here. The regex parser takes the first
+//     word characters followed by '=' anywhere in the line, so "my-key=1"
+//     is key=1 and "; k=v" inside a section is an entry.
+//   - A section name ends at the first ']' here and at the last one for the
+//     regex parser, "[a]b]" is section "a" here and "a]b" there.
+//   - A header has to start the line here. The regex parser finds "[S]"
+//     anywhere in a line between sections, "x=[S]" included.
+class IniScanner
+{
+public:
+  enum class LineKind : std::uint8_t
+  {
+    Blank,
+    Comment,
+    Section,
+    Entry,
+    Append,
+    Unknown
+  };
+
+  static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+  struct Line
+  {
+    LineKind         Kind = LineKind::Unknown;
+    std::string_view Name;   // section name or entry key
+    std::string_view Value;  // entry value with trailing whitespace removed
+  };
+
+  static Line ClassifyLine(std::string_view Text)
+  {
+    using namespace IniCharClass;
+
+    Line Result;
+
+    while (!Text.empty() && Is(Text.back(), LineEnd))
+      Text.remove_suffix(1);
+
+    std::size_t Pos = 0;
+    const std::size_t Size = Text.size();
+
+    while (Pos < Size && (Text[Pos] == ' ' || Text[Pos] == '\t'))
+      ++Pos;
+
+    if (Pos == Size)
+    {
+      Result.Kind = LineKind::Blank;
+      return Result;
+    }
+
+    const char First = Text[Pos];
+    if (Is(First, Comment))
+    {
+      Result.Kind = LineKind::Comment;
+      return Result;
+    }
+
+    if (First == '[')
+    {
+      const std::size_t Close = Text.find(']', Pos + 1);
+      if (Close != std::string_view::npos && Close > Pos + 1)
+      {
+        Result.Kind = LineKind::Section;
+        Result.Name = Text.substr(Pos + 1, Close - Pos - 1);
+      }
+      return Result;
+    }
+
+    const bool Append = (First == '+');
+    if (Append)
+      ++Pos;
+
+    const std::size_t KeyStart = Pos;
+    while (Pos < Size && Is(Text[Pos], Word))
+      ++Pos;
+
+    if (Pos == KeyStart || Pos == Size || Text[Pos] != '=')
+      return Result;
+
+    const std::size_t KeyEnd = Pos++;
+    const std::size_t ValueStart = Pos;
+    while (Pos < Size && !Is(Text[Pos], Comment | LineEnd))
+      ++Pos;
+
+    std::size_t ValueEnd = Pos;
+    while (ValueEnd > ValueStart && Is(Text[ValueEnd - 1], Space))
+      --ValueEnd;
+
+    Result.Kind = Append ? LineKind::Append : LineKind::Entry;
+    Result.Name = Text.substr(KeyStart, KeyEnd - KeyStart);
+    Result.Value = Text.substr(ValueStart, ValueEnd - ValueStart);
+    return Result;
+  }
+
+  // What a writer may put back into a file so that it scans as written
+  static bool IsWritableSectionName(std::string_view Name)
+  {
+    if (Name.empty())
+      return false;
+
+    for (char c : Name)
+      if (c == ']' || IniCharClass::Is(c, IniCharClass::LineEnd))
+        return false;
+
+    return true;
+  }
+
+  static bool IsWritableKey(std::string_view Key)
+  {
+    if (Key.empty())
+      return false;
+
+    for (char c : Key)
+      if (!IniCharClass::Is(c, IniCharClass::Word))
+        return false;
+
+    return true;
+  }
+
+  // A value ends at a comment character or line end and has trailing
+  // whitespace trimmed, so those cannot be written
+  static bool IsWritableValue(std::string_view Value)
+  {
+    for (char c : Value)
+      if (IniCharClass::Is(c, IniCharClass::Comment | IniCharClass::LineEnd))
+        return false;
+
+    return Value.empty() || !IniCharClass::Is(Value.back(), IniCharClass::Space);
+  }
+
+  // Handler must provide:
+  //   void OnSection(std::string_view Name);
+  //   void OnEntry(std::string_view Key, std::string_view Value, bool Append);
+  template<class Handler>
+  void ScanLine(std::string_view Text, Handler &H)
+  {
+    const Line Current = ClassifyLine(Text);
+
+    switch (Current.Kind)
+    {
+      case LineKind::Blank:
+        m_InSection = false;
+        break;
+      case LineKind::Section:
+        // Like the regex parser, a header is only recognized between sections
+        if (!m_InSection)
+        {
+          m_InSection = true;
+          H.OnSection(Current.Name);
+        }
+        break;
+      case LineKind::Entry:
+      case LineKind::Append:
+        if (m_InSection)
+          H.OnEntry(Current.Name, Current.Value, Current.Kind == LineKind::Append);
+        break;
+      default:
+        break;
+    }
+  }
+
+  template<class Handler>
+  void Scan(std::string_view Buffer, Handler &H)
+  {
+    const char *Cursor = Buffer.data();
+    const char *End = Cursor + Buffer.size();
+
+    while (Cursor < End)
+    {
+      const char *NewLine = static_cast<const char *>(std::memchr(Cursor, '\n', static_cast<std::size_t>(End - Cursor)));
+      const char *LineEnd = NewLine ? NewLine : End;
+
+      ScanLine(std::string_view(Cursor, static_cast<std::size_t>(LineEnd - Cursor)), H);
+      Cursor = NewLine ? NewLine + 1 : End;
+    }
+  }
+
+  // Reads In in blocks of BlockSize bytes and splits the lines itself, so there
+  // is one stream call per block instead of one std::getline call per line
+  template<class Handler>
+  void ScanStream(std::istream &In, Handler &H, std::size_t BlockSize = DefaultBlockSize)
+  {
+    std::vector<char> Block(BlockSize > 0 ? BlockSize : DefaultBlockSize);
+    std::string       Carry;
+
+    while (In)
+    {
+      In.read(Block.data(), static_cast<std::streamsize>(Block.size()));
+      const std::size_t Count = static_cast<std::size_t>(In.gcount());
+
+      const char *Cursor = Block.data();
+      const char *End = Cursor + Count;
+
+      while (Cursor < End)
+      {
+        const char *NewLine = static_cast<const char *>(std::memchr(Cursor, '\n', static_cast<std::size_t>(End - Cursor)));
+
+        // A line that runs past the end of the block is finished by the next one
+        if (!NewLine)
+        {
+          Carry.append(Cursor, End);
+          break;
+        }
+
+        if (Carry.empty())
+        {
+          ScanLine(std::string_view(Cursor, static_cast<std::size_t>(NewLine - Cursor)), H);
+        }
+        else
+        {
+          Carry.append(Cursor, NewLine);
+          ScanLine(Carry, H);
+          Carry.clear();
+        }
+
+        Cursor = NewLine + 1;
+      }
+    }
+
+    if (!Carry.empty())
+      ScanLine(Carry, H);
+  }
+
+  void Reset()
+  {
+    m_InSection = false;
+  }
+
+private:
+  bool m_InSection = false;
+};
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FrozenIni.h"
+#include "IniFile.h"
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+// Read-only view of a FrozenIni that any number of threads can share
+//
+// IniFile, IniSection and IniEntry are not safe to read from several threads
+// at once: IniSection::operator[] adds the entry on a miss and IniEntry
+// caches the last converted value. A snapshot only has const lookups over a
+// FrozenIni that nothing writes after it is built, so lookups take no lock
+// and write nothing, not even an atomic.
+//
+// Copies share the FrozenIni. Copying is the one shared write (a reference
+// count increment) and belongs outside the read loop: copy once per thread or
+// per request, then look up as much as needed.
+class IniSharedSnapshot
+{
+public:
+  using EntryView = FrozenIni::EntryView;
+  using SectionView = FrozenIni::SectionView;
+
+  // Empty, finds nothing
+  IniSharedSnapshot();
+  explicit IniSharedSnapshot(const IniFile &File);
+
+  // Not explicit, so IniWatcher::GetSnapshot converts to a snapshot
+  IniSharedSnapshot(std::shared_ptr<const FrozenIni> Frozen);
+
+  bool HasSection(std::string_view SectionName) const
+  {
+    return m_Frozen->HasSection(SectionName);
+  }
+
+  std::optional<SectionView> TryGetSection(std::string_view SectionName) const
+  {
+    return m_Frozen->TryGetSection(SectionName);
+  }
+
+  std::optional<SectionView> TryGetSection(const IniHashedName &SectionName) const
+  {
+    return m_Frozen->TryGetSection(SectionName);
+  }
+
+  std::optional<EntryView> TryGetEntry(std::string_view SectionName, std::string_view Key) const
+  {
+    return m_Frozen->TryGetEntry(SectionName, Key);
+  }
+
+  std::optional<EntryView> TryGetEntry(const IniKey &Key) const
+  {
+    return m_Frozen->TryGetEntry(Key);
+  }
+
+  std::size_t GetNumSections() const
+  {
+    return m_Frozen->GetNumSections();
+  }
+
+  std::size_t GetNumEntries() const
+  {
+    return m_Frozen->GetNumEntries();
+  }
+
+  SectionView GetSection(std::size_t Index) const
+  {
+    return m_Frozen->GetSection(Index);
+  }
+
+  const FrozenIni &GetFrozen() const
+  {
+    return *m_Frozen;
+  }
+
+  // True when both share one FrozenIni
+  bool IsSameAs(const IniSharedSnapshot &Other) const
+  {
+    return m_Frozen == Other.m_Frozen;
+  }
+
+private:
+  static const std::shared_ptr<const FrozenIni> &GetEmpty();
+
+  std::shared_ptr<const FrozenIni> m_Frozen;
+};
@@ -0,0 +1,473 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Vector that keeps its first InlineCapacity elements inside the object and
+// only goes to the allocator once it grows past them
+//
+// Used for IniEntry's values, where almost every entry holds one or two. The
+// elements are constructed through the allocator, so with a
+// polymorphic_allocator they get the same memory_resource as the container.
+// As with std::vector, growing or inserting invalidates iterators and
+// references, and moving a container with its elements inline moves the
+// elements instead of handing over a buffer.
+template<class T, std::size_t InlineCapacity, class Allocator = std::pmr::polymorphic_allocator<T>>
+class IniSmallVector
+{
+  static_assert(InlineCapacity > 0, "IniSmallVector needs room for at least one inline element");
+
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  IniSmallVector() = default;
+
+  explicit IniSmallVector(const allocator_type &Alloc)
+      : m_Alloc(Alloc)
+  {}
+
+  IniSmallVector(const IniSmallVector &Other)
+      : IniSmallVector(Other, alloc_traits::select_on_container_copy_construction(Other.m_Alloc))
+  {}
+
+  IniSmallVector(const IniSmallVector &Other, const allocator_type &Alloc)
+      : m_Alloc(Alloc)
+  {
+    reserve(Other.m_Size);
+    for (const T &Value : Other)
+      emplace_back(Value);
+  }
+
+  IniSmallVector(IniSmallVector &&Other) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : m_Alloc(Other.m_Alloc)
+  {
+    TakeContents(Other);
+  }
+
+  IniSmallVector(IniSmallVector &&Other, const allocator_type &Alloc)
+      : m_Alloc(Alloc)
+  {
+    if (m_Alloc == Other.m_Alloc)
+    {
+      TakeContents(Other);
+      return;
+    }
+
+    reserve(Other.m_Size);
+    for (T &Value : Other)
+      emplace_back(std::move(Value));
+    Other.clear();
+  }
+
+  ~IniSmallVector()
+  {
+    clear();
+    ReleaseBuffer();
+  }
+
+  IniSmallVector &operator=(const IniSmallVector &Other)
+  {
+    if (this == &Other)
+      return *this;
+
+    clear();
+    reserve(Other.m_Size);
+    for (const T &Value : Other)
+      emplace_back(Value);
+
+    return *this;
+  }
+
+  IniSmallVector &operator=(IniSmallVector &&Other)
+  {
+    if (this == &Other)
+      return *this;
+
+    clear();
+
+    // polymorphic_allocator does not propagate, a buffer from another
+    // resource has to be copied element by element
+    if (m_Alloc == Other.m_Alloc)
+    {
+      ReleaseBuffer();
+      TakeContents(Other);
+      return *this;
+    }
+
+    reserve(Other.m_Size);
+    for (T &Value : Other)
+      emplace_back(std::move(Value));
+    Other.clear();
+
+    return *this;
+  }
+
+  allocator_type get_allocator() const
+  {
+    return m_Alloc;
+  }
+
+  iterator begin()
+  {
+    return m_Data;
+  }
+
+  iterator end()
+  {
+    return m_Data + m_Size;
+  }
+
+  const_iterator begin() const
+  {
+    return m_Data;
+  }
+
+  const_iterator end() const
+  {
+    return m_Data + m_Size;
+  }
+
+  const_iterator cbegin() const
+  {
+    return m_Data;
+  }
+
+  const_iterator cend() const
+  {
+    return m_Data + m_Size;
+  }
+
+  reverse_iterator rbegin()
+  {
+    return reverse_iterator(end());
+  }
+
+  reverse_iterator rend()
+  {
+    return reverse_iterator(begin());
+  }
+
+  const_reverse_iterator rbegin() const
+  {
+    return const_reverse_iterator(end());
+  }
+
+  const_reverse_iterator rend() const
+  {
+    return const_reverse_iterator(begin());
+  }
+
+  const_reverse_iterator crbegin() const
+  {
+    return const_reverse_iterator(end());
+  }
+
+  const_reverse_iterator crend() const
+  {
+    return const_reverse_iterator(begin());
+  }
+
+  bool empty() const
+  {
+    return m_Size == 0;
+  }
+
+  size_type size() const
+  {
+    return m_Size;
+  }
+
+  size_type capacity() const
+  {
+    return m_Capacity;
+  }
+
+  // True while the elements still live in the inline buffer
+  bool is_inline() const
+  {
+    return m_Data == InlineData();
+  }
+
+  T *data()
+  {
+    return m_Data;
+  }
+
+  const T *data() const
+  {
+    return m_Data;
+  }
+
+  T &operator[](size_type Index)
+  {
+    return m_Data[Index];
+  }
+
+  const T &operator[](size_type Index) const
+  {
+    return m_Data[Index];
+  }
+
+  T &at(size_type Index)
+  {
+    if (Index >= m_Size)
+      throw std::out_of_range("IniSmallVector::at");
+
+    return m_Data[Index];
+  }
+
+  const T &at(size_type Index) const
+  {
+    if (Index >= m_Size)
+      throw std::out_of_range("IniSmallVector::at");
+
+    return m_Data[Index];
+  }
+
+  T &front()
+  {
+    return m_Data[0];
+  }
+
+  const T &front() const
+  {
+    return m_Data[0];
+  }
+
+  T &back()
+  {
+    return m_Data[m_Size - 1];
+  }
+
+  const T &back() const
+  {
+    return m_Data[m_Size - 1];
+  }
+
+  void reserve(size_type NewCapacity)
+  {
+    if (NewCapacity > m_Capacity)
+      Reallocate(NewCapacity, m_Size, 0, [](T *) {});
+  }
+
+  template<class... Args>
+  T &emplace_back(Args &&... args)
+  {
+    return *emplace(cend(), std::forward<Args>(args)...);
+  }
+
+  void push_back(const T &Value)
+  {
+    emplace_back(Value);
+  }
+
+  void push_back(T &&Value)
+  {
+    emplace_back(std::move(Value));
+  }
+
+  template<class... Args>
+  T &emplace_front(Args &&... args)
+  {
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+  }
+
+  template<class... Args>
+  iterator emplace(const_iterator Position, Args &&... args)
+  {
+    const size_type Index = static_cast<size_type>(Position - m_Data);
+
+    if (m_Size == m_Capacity)
+    {
+      // The new element is built first, args may refer into the old buffer
+      Reallocate(m_Capacity * 2, Index, 1, [&](T *Where) { alloc_traits::construct(m_Alloc, Where, std::forward<Args>(args)...); });
+      return m_Data + Index;
+    }
+
+    alloc_traits::construct(m_Alloc, m_Data + m_Size, std::forward<Args>(args)...);
+    ++m_Size;
+    std::rotate(m_Data + Index, m_Data + m_Size - 1, m_Data + m_Size);
+
+    return m_Data + Index;
+  }
+
+  iterator erase(const_iterator Position)
+  {
+    return erase(Position, Position + 1);
+  }
+
+  iterator erase(const_iterator First, const_iterator Last)
+  {
+    T *const Begin = m_Data + (First - m_Data);
+    T *const End = m_Data + (Last - m_Data);
+
+    if (Begin == End)
+      return Begin;
+
+    T *const NewEnd = std::move(End, m_Data + m_Size, Begin);
+    for (T *it = NewEnd; it != m_Data + m_Size; ++it)
+      alloc_traits::destroy(m_Alloc, it);
+
+    m_Size = static_cast<size_type>(NewEnd - m_Data);
+    return Begin;
+  }
+
+  void clear()
+  {
+    for (size_type i = 0; i < m_Size; ++i)
+      alloc_traits::destroy(m_Alloc, m_Data + i);
+
+    m_Size = 0;
+  }
+
+  // Like std::vector::swap, the allocators are expected to compare equal
+  void swap(IniSmallVector &Other)
+  {
+    if (!is_inline() && !Other.is_inline())
+    {
+      std::swap(m_Data, Other.m_Data);
+      std::swap(m_Size, Other.m_Size);
+      std::swap(m_Capacity, Other.m_Capacity);
+      return;
+    }
+
+    IniSmallVector Temp(std::move(*this));
+    *this = std::move(Other);
+    Other = std::move(Temp);
+  }
+
+  friend bool operator==(const IniSmallVector &LHS, const IniSmallVector &RHS)
+  {
+    return std::equal(LHS.begin(), LHS.end(), RHS.begin(), RHS.end());
+  }
+
+  friend bool operator!=(const IniSmallVector &LHS, const IniSmallVector &RHS)
+  {
+    return !(LHS == RHS);
+  }
+
+private:
+  T *InlineData()
+  {
+    return reinterpret_cast<T *>(m_Inline);
+  }
+
+  const T *InlineData() const
+  {
+    return reinterpret_cast<const T *>(m_Inline);
+  }
+
+  // Moves the elements to a heap buffer of NewCapacity, leaving Inserted
+  // slots at Gap for Construct to fill
+  template<class ConstructFn>
+  void Reallocate(size_type NewCapacity, size_type Gap, size_type Inserted, ConstructFn &&Construct)
+  {
+    T *const NewData = alloc_traits::allocate(m_Alloc, NewCapacity);
+
+    try
+    {
+      if (Inserted)
+        Construct(NewData + Gap);
+    }
+    catch (...)
+    {
+      alloc_traits::deallocate(m_Alloc, NewData, NewCapacity);
+      throw;
+    }
+
+    for (size_type i = 0; i < m_Size; ++i)
+      alloc_traits::construct(m_Alloc, NewData + i + (i >= Gap ? Inserted : 0), std::move(m_Data[i]));
+
+    const size_type NewSize = m_Size + Inserted;
+    clear();
+    ReleaseBuffer();
+
+    m_Data = NewData;
+    m_Size = NewSize;
+    m_Capacity = NewCapacity;
+  }
+
+  void ReleaseBuffer()
+  {
+    if (!is_inline())
+      alloc_traits::deallocate(m_Alloc, m_Data, m_Capacity);
+
+    m_Data = InlineData();
+    m_Capacity = InlineCapacity;
+  }
+
+  // Takes Other's elements, this must be empty and inline
+  void TakeContents(IniSmallVector &Other)
+  {
+    if (Other.is_inline())
+    {
+      for (T &Value : Other)
+        alloc_traits::construct(m_Alloc, m_Data + m_Size++, std::move(Value));
+      Other.clear();
+      return;
+    }
+
+    m_Data = Other.m_Data;
+    m_Size = Other.m_Size;
+    m_Capacity = Other.m_Capacity;
+
+    Other.m_Data = Other.InlineData();
+    Other.m_Size = 0;
+    Other.m_Capacity = InlineCapacity;
+  }
+
+  allocator_type m_Alloc;
+  T *            m_Data = InlineData();
+  size_type      m_Size = 0;
+  size_type      m_Capacity = InlineCapacity;
+  alignas(T) unsigned char m_Inline[sizeof(T) * InlineCapacity];
+};
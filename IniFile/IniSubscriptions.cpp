@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniSubscriptions.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+  template<class Subscribers>
+  bool EraseSubscriber(Subscribers &List, IniSubscriptions::Id Subscription)
+  {
+    auto it = std::find_if(List.begin(), List.end(), [Subscription](const auto &Entry) { return Entry.Subscription == Subscription; });
+    if (it == List.end())
+      return false;
+
+    List.erase(it);
+    return true;
+  }
+}  // namespace
+
+IniSubscriptions::Id IniSubscriptions::Subscribe(std::string_view SectionName, std::string_view Key, EntryCallback Callback)
+{
+  if (Key.empty())
+    return None;
+
+  const Id Subscription = m_NextId++;
+
+  SectionSubscribers &Section = m_Sections.try_emplace(SectionName).first->second;
+  Section.Keys.try_emplace(Key).first->second.push_back({Subscription, std::move(Callback)});
+
+  m_Locations.emplace(Subscription, Location{std::string(SectionName), std::string(Key)});
+  return Subscription;
+}
+
+IniSubscriptions::Id IniSubscriptions::SubscribeSection(std::string_view SectionName, SectionCallback Callback)
+{
+  const Id Subscription = m_NextId++;
+
+  m_Sections.try_emplace(SectionName).first->second.Whole.push_back({Subscription, std::move(Callback)});
+
+  m_Locations.emplace(Subscription, Location{std::string(SectionName), std::string()});
+  return Subscription;
+}
+
+bool IniSubscriptions::Unsubscribe(Id Subscription)
+{
+  auto LocationIt = m_Locations.find(Subscription);
+  if (LocationIt == m_Locations.end())
+    return false;
+
+  const Location &Where = LocationIt->second;
+  auto            SectionIt = m_Sections.find(Where.SectionName);
+  SectionSubscribers &Section = SectionIt->second;
+
+  if (Where.Key.empty())
+  {
+    EraseSubscriber(Section.Whole, Subscription);
+  }
+  else
+  {
+    auto KeyIt = Section.Keys.find(Where.Key);
+    EraseSubscriber(KeyIt->second, Subscription);
+
+    if (KeyIt->second.empty())
+      Section.Keys.erase(KeyIt);
+  }
+
+  // Sections nobody listens to any more leave the index
+  if (Section.Whole.empty() && Section.Keys.empty())
+    m_Sections.erase(SectionIt);
+
+  m_Locations.erase(LocationIt);
+  return true;
+}
+
+void IniSubscriptions::Dispatch(const IniDiff &Diff) const
+{
+  if (m_Sections.empty())
+    return;
+
+  for (const IniDiff::SectionChange &Changed : Diff.GetSections())
+  {
+    auto SectionIt = m_Sections.find(Changed.Name);
+    if (SectionIt == m_Sections.end())
+      continue;
+
+    const SectionSubscribers &Section = SectionIt->second;
+    for (const Subscriber<SectionCallback> &Whole : Section.Whole)
+      Whole.Call(Changed);
+
+    if (Section.Keys.empty())
+      continue;
+
+    for (const IniDiff::EntryChange &Entry : Changed.Entries)
+    {
+      auto KeyIt = Section.Keys.find(Entry.Key);
+      if (KeyIt == Section.Keys.end())
+        continue;
+
+      for (const Subscriber<EntryCallback> &Subscriber : KeyIt->second)
+        Subscriber.Call(Changed.Name, Entry);
+    }
+  }
+}
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniDiff.h"
+#include "IniFlatMap.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Callbacks on Section.Key paths and on whole sections, called with the parts
+// of an IniDiff that concern them
+//
+// Subscriptions are indexed by section name and then by key. Dispatch looks up
+// each changed section and each of its changed entries once, so its cost
+// follows the number of changes, not the number of subscriptions. An entry
+// callback is called when the entry was added, removed or had any of its
+// values changed, which includes every entry of an added or removed section.
+//
+// Not safe to use from several threads at once, see IniWatcher::Subscribe for
+// subscriptions that are dispatched on reload.
+class IniSubscriptions
+{
+public:
+  using Id = std::uint64_t;
+  using EntryCallback = std::function<void(std::string_view SectionName, const IniDiff::EntryChange &Change)>;
+  using SectionCallback = std::function<void(const IniDiff::SectionChange &Change)>;
+
+  // Never returned for a subscription that was made
+  static constexpr Id None = 0;
+
+  // Subscribe returns None, and subscribes nothing, for an empty Key: no
+  // entry can have one, and it marks section subscriptions internally
+  Id Subscribe(std::string_view SectionName, std::string_view Key, EntryCallback Callback);
+  Id SubscribeSection(std::string_view SectionName, SectionCallback Callback);
+
+  // False when there is no such subscription
+  bool Unsubscribe(Id Subscription);
+
+  bool IsEmpty() const
+  {
+    return m_Locations.empty();
+  }
+
+  std::size_t GetNumSubscriptions() const
+  {
+    return m_Locations.size();
+  }
+
+  // For each changed section, calls its section callbacks and then the entry
+  // callbacks of its changed entries, each in the order they subscribed.
+  // Callbacks must not subscribe or unsubscribe.
+  void Dispatch(const IniDiff &Diff) const;
+
+private:
+  template<class Callback>
+  struct Subscriber
+  {
+    Id       Subscription;
+    Callback Call;
+  };
+
+  using entry_subscribers_t = std::vector<Subscriber<EntryCallback>>;
+
+  struct SectionSubscribers
+  {
+    std::vector<Subscriber<SectionCallback>>                                   Whole;
+    IniFlatMap<std::string, entry_subscribers_t, IniStringHash, std::equal_to<>> Keys;
+  };
+
+  // Where a subscription is, so Unsubscribe goes straight to it. The key of a
+  // section subscription is empty, which no entry key can be.
+  struct Location
+  {
+    std::string SectionName;
+    std::string Key;
+  };
+
+  IniFlatMap<std::string, SectionSubscribers, IniStringHash, std::equal_to<>> m_Sections;
+  std::unordered_map<Id, Location>                                           m_Locations;
+  Id                                                                         m_NextId = 1;
+};
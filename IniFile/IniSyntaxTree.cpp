@@ -0,0 +1,373 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniSyntaxTree.h"
+
+#include "IniScanner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+
+namespace
+{
+  // Same test as IniScanner::ClassifyLine, a blank line ends a block
+  bool IsBlankLine(std::string_view Text)
+  {
+    while (!Text.empty() && IniCharClass::Is(Text.back(), IniCharClass::LineEnd))
+      Text.remove_suffix(1);
+
+    return Text.find_first_not_of(" \t") == std::string_view::npos;
+  }
+}  // namespace
+
+// Finds the blocks of each section, the IniFile is filled separately
+struct IniSyntaxTree::ScanHandler
+{
+  IniSyntaxTree &     Tree;
+  std::vector<Block> *Open = nullptr;  // blocks of the section being read
+  std::uint32_t       Line = None;
+
+  void OnSection(std::string_view Name)
+  {
+    Open = &Tree.m_Sections[Name];
+    Open->push_back({Line, Line});
+  }
+
+  void OnEntry(std::string_view, std::string_view, bool)
+  {}
+};
+
+bool IniSyntaxTree::ReadFile(const std::string &FileName)
+{
+  Clear();
+
+  IniMappedFile Mapped;
+  if (!Mapped.Open(FileName, IniReadMode::MappedSequential))
+    return false;
+
+  // Copied, the lines have to outlive the mapping when the file is written back
+  const std::string_view Text = Mapped.GetView();
+  m_Buffer.assign(Text.begin(), Text.end());
+  Parse();
+  return true;
+}
+
+void IniSyntaxTree::ParseBuffer(std::string_view Buffer)
+{
+  Clear();
+
+  m_Buffer.assign(Buffer.begin(), Buffer.end());
+  Parse();
+}
+
+void IniSyntaxTree::Parse()
+{
+  const std::string_view Text(m_Buffer.data(), m_Buffer.size());
+
+  m_File.ParseBuffer(Text);
+
+  // New lines are written with the file's own line ends
+  m_NewLine = (Text.find("\r\n") != std::string_view::npos) ? "\r\n" : "\n";
+  m_Lines.reserve(static_cast<std::size_t>(std::count(Text.begin(), Text.end(), '\n')) + 1);
+
+  IniScanner  Scanner;
+  ScanHandler Handler{*this};
+
+  const char *Cursor = Text.data();
+  const char *End = Cursor + Text.size();
+
+  while (Cursor < End)
+  {
+    const char *NewLine = static_cast<const char *>(std::memchr(Cursor, '\n', static_cast<std::size_t>(End - Cursor)));
+    const char *LineEnd = NewLine ? NewLine + 1 : End;
+
+    const std::string_view LineText(Cursor, static_cast<std::size_t>(LineEnd - Cursor));
+    Handler.Line = AppendLine(LineText);
+    Scanner.ScanLine(LineText, Handler);
+
+    if (IsBlankLine(LineText))
+      Handler.Open = nullptr;
+    else if (Handler.Open)
+      Handler.Open->back().Last = Handler.Line;
+
+    Cursor = LineEnd;
+  }
+}
+
+bool IniSyntaxTree::SetValue(std::string_view SectionName, std::string_view Key, std::string_view Value)
+{
+  if (!IniScanner::IsWritableKey(Key) || !IniScanner::IsWritableValue(Value))
+    return false;
+
+  auto SectionIt = m_Sections.find(SectionName);
+  if (SectionIt == m_Sections.end())
+    return AddValue(SectionName, Key, Value);
+
+  const EntryLines Entry = FindEntry(SectionIt->second.front(), Key);
+  if (Entry.Values.empty())
+    return AddValue(SectionName, Key, Value);
+
+  // Only the value is replaced, the indentation, spacing and comment around
+  // it stay as they were
+  Line &                 First = m_Lines[Entry.Values.front()];
+  const std::string_view OldValue = IniScanner::ClassifyLine(First.Text).Value;
+  const std::size_t      ValueBegin = static_cast<std::size_t>(OldValue.data() - First.Text.data());
+
+  std::string Text;
+  Text.reserve(First.Text.size() - OldValue.size() + Value.size());
+  Text.append(First.Text.substr(0, ValueBegin));
+  Text.append(Value);
+  Text.append(First.Text.substr(ValueBegin + OldValue.size()));
+  First.Text = Store(std::move(Text));
+
+  for (std::size_t i = 1; i < Entry.Values.size(); ++i)
+    m_Lines[Entry.Values[i]].Removed = true;
+
+  IniEntry &FileEntry = m_File.TryGetSection(SectionName)->get()[Key];
+  FileEntry.Clear();
+  FileEntry.AddValue(Value);
+  return true;
+}
+
+bool IniSyntaxTree::AddValue(std::string_view SectionName, std::string_view Key, std::string_view Value)
+{
+  if (!IniScanner::IsWritableKey(Key) || !IniScanner::IsWritableValue(Value))
+    return false;
+
+  Block *Lines = FindOrAddSection(SectionName);
+  if (!Lines)
+    return false;
+
+  const EntryLines Entry = FindEntry(*Lines, Key);
+
+  std::string Text;
+  if (!Entry.Values.empty())
+    Text += '+';
+  Text.append(Key).append("=").append(Value).append(m_NewLine);
+
+  InsertLine(*Lines, Entry.Values.empty() ? Entry.LastEntry : Entry.Values.back(), Store(std::move(Text)));
+
+  m_File.TryGetSection(SectionName)->get()[Key].AddValue(Value);
+  return true;
+}
+
+bool IniSyntaxTree::RemoveEntry(std::string_view SectionName, std::string_view Key)
+{
+  auto SectionIt = m_Sections.find(SectionName);
+  if (SectionIt == m_Sections.end())
+    return false;
+
+  const EntryLines Entry = FindEntry(SectionIt->second.front(), Key);
+  if (Entry.Values.empty())
+    return false;
+
+  for (std::uint32_t Index : Entry.Values)
+    m_Lines[Index].Removed = true;
+
+  m_File.TryGetSection(SectionName)->get().RemoveEntry(Key);
+  return true;
+}
+
+bool IniSyntaxTree::AddSection(std::string_view SectionName)
+{
+  if (m_Sections.find(SectionName) != m_Sections.end())
+    return false;
+
+  return FindOrAddSection(SectionName) != nullptr;
+}
+
+bool IniSyntaxTree::RemoveSection(std::string_view SectionName)
+{
+  auto SectionIt = m_Sections.find(SectionName);
+  if (SectionIt == m_Sections.end())
+    return false;
+
+  for (const Block &Lines : SectionIt->second)
+    RemoveLines(Lines);
+
+  m_Sections.erase(SectionIt);
+  m_File.m_Sections.erase(m_File.m_Sections.find(SectionName));
+  return true;
+}
+
+std::string IniSyntaxTree::GetText() const
+{
+  std::size_t Size = 0;
+  for (const Line &Current : m_Lines)
+    Size += Current.Removed ? 0 : Current.Text.size();
+
+  std::string Text;
+  Text.reserve(Size);
+
+  for (std::uint32_t Index = m_FirstLine; Index != None; Index = m_Lines[Index].Next)
+    if (!m_Lines[Index].Removed)
+      Text.append(m_Lines[Index].Text);
+
+  return Text;
+}
+
+bool IniSyntaxTree::WriteTo(std::ostream &Out) const
+{
+  const std::string Text = GetText();
+
+  Out.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+  return static_cast<bool>(Out);
+}
+
+// Renamed over the file once it is written in full, see IniReplaceFile
+bool IniSyntaxTree::WriteFile(const std::string &FileName) const
+{
+  return IniReplaceFile(FileName, GetText());
+}
+
+void IniSyntaxTree::Clear()
+{
+  m_File = IniFile();
+  m_Buffer.clear();
+  m_NewLine = "\n";
+  m_Lines.clear();
+  m_FirstLine = None;
+  m_LastLine = None;
+  m_EditedText.clear();
+  m_Sections.clear();
+}
+
+// Edits are rare next to lookups, so entry lines are found by reading the
+// block again rather than kept in an index
+IniSyntaxTree::EntryLines IniSyntaxTree::FindEntry(const Block &Lines, std::string_view Key) const
+{
+  EntryLines Entry;
+  Entry.LastEntry = Lines.First;
+
+  for (std::uint32_t Index = m_Lines[Lines.First].Next; Index != None && Index != m_Lines[Lines.Last].Next; Index = m_Lines[Index].Next)
+  {
+    if (m_Lines[Index].Removed)
+      continue;
+
+    const IniScanner::Line Parsed = IniScanner::ClassifyLine(m_Lines[Index].Text);
+    if (Parsed.Kind != IniScanner::LineKind::Entry && Parsed.Kind != IniScanner::LineKind::Append)
+      continue;
+
+    Entry.LastEntry = Index;
+    if (Parsed.Name == Key)
+      Entry.Values.push_back(Index);
+  }
+
+  return Entry;
+}
+
+std::uint32_t IniSyntaxTree::AppendLine(std::string_view Text)
+{
+  const auto Index = static_cast<std::uint32_t>(m_Lines.size());
+  m_Lines.push_back({Text, None, false});
+
+  if (m_LastLine != None)
+    m_Lines[m_LastLine].Next = Index;
+  else
+    m_FirstLine = Index;
+
+  m_LastLine = Index;
+  return Index;
+}
+
+std::uint32_t IniSyntaxTree::InsertLine(Block &Lines, std::uint32_t After, std::string_view Text)
+{
+  EndLine(After);
+
+  const auto Index = static_cast<std::uint32_t>(m_Lines.size());
+  m_Lines.push_back({Text, m_Lines[After].Next, false});
+  m_Lines[After].Next = Index;
+
+  // The line joins whatever ended at After
+  if (m_LastLine == After)
+    m_LastLine = Index;
+  if (Lines.Last == After)
+    Lines.Last = Index;
+
+  return Index;
+}
+
+// Gives the last line of the file the line end it lacks, before a line goes after it
+void IniSyntaxTree::EndLine(std::uint32_t Index)
+{
+  const std::string_view Text = m_Lines[Index].Text;
+  if (Text.empty() || Text.back() != '\n')
+    m_Lines[Index].Text = Store(std::string(Text).append(m_NewLine));
+}
+
+std::string_view IniSyntaxTree::Store(std::string Text)
+{
+  // A deque never moves its elements, so the views stay valid
+  m_EditedText.push_back(std::move(Text));
+  return m_EditedText.back();
+}
+
+IniSyntaxTree::Block *IniSyntaxTree::FindOrAddSection(std::string_view SectionName)
+{
+  auto SectionIt = m_Sections.find(SectionName);
+  if (SectionIt != m_Sections.end())
+    return &SectionIt->second.front();
+
+  if (!IniScanner::IsWritableSectionName(SectionName))
+    return nullptr;
+
+  std::uint32_t LastLine = None;
+  for (std::uint32_t Index = m_FirstLine; Index != None; Index = m_Lines[Index].Next)
+    if (!m_Lines[Index].Removed)
+      LastLine = Index;
+
+  // A header is only read at the start of the file or after a blank line
+  if (LastLine != None)
+  {
+    EndLine(LastLine);
+    if (!IsBlankLine(m_Lines[LastLine].Text))
+      AppendLine(m_NewLine);
+  }
+
+  const std::string_view Header = Store(std::string("[").append(SectionName).append("]").append(m_NewLine));
+  const std::uint32_t    Index = AppendLine(Header);
+
+  std::vector<Block> &Blocks = m_Sections[Header.substr(1, SectionName.size())];
+  Blocks.push_back({Index, Index});
+
+  m_File.m_Sections.try_emplace(SectionName, SectionName);
+  return &Blocks.front();
+}
+
+void IniSyntaxTree::RemoveLines(const Block &Lines)
+{
+  for (std::uint32_t Index = Lines.First; Index != None; Index = m_Lines[Index].Next)
+  {
+    m_Lines[Index].Removed = true;
+    if (Index == Lines.Last)
+      break;
+  }
+}
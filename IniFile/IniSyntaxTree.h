@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "IniFile.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Lossless view of an ini file that can be edited and written back
+//
+// The parsed contents are an ordinary IniFile, built before anything else so
+// it is laid out in memory as if it was read on its own, and lookups go
+// straight to it. Everything the parser drops (comments, blank lines,
+// spacing, line order, "+Key=" lines, blocks the parser ignores, line ends)
+// is kept out of line as the list of the file's lines, each one a view of the
+// text it was read from, and where each section's blocks start and end.
+//
+// Edits change the IniFile and the lines together. A changed value rewrites
+// only the value on its line, keeping the indentation and trailing comment,
+// and new lines use the file's line ends. Lines that were not edited are
+// written back byte for byte, so an unedited tree writes the file it read.
+class IniSyntaxTree
+{
+public:
+  IniSyntaxTree() = default;
+  IniSyntaxTree(const IniSyntaxTree &) = delete;
+  IniSyntaxTree(IniSyntaxTree &&) = default;
+
+  IniSyntaxTree &operator=(const IniSyntaxTree &) = delete;
+  IniSyntaxTree &operator=(IniSyntaxTree &&) = default;
+
+  // Replace the contents of the tree with the file or a copy of Buffer
+  bool ReadFile(const std::string &FileName);
+  void ParseBuffer(std::string_view Buffer);
+
+  const IniFile &GetFile() const
+  {
+    return m_File;
+  }
+
+  std::optional<std::reference_wrapper<const IniSection>> TryGetSection(std::string_view SectionName) const
+  {
+    auto SectionIt = m_File.m_Sections.find(SectionName);
+    if (SectionIt == m_File.m_Sections.end())
+      return std::nullopt;
+
+    return std::make_optional(std::cref(SectionIt->second));
+  }
+
+  std::optional<std::reference_wrapper<const IniEntry>> TryGetEntry(std::string_view SectionName, std::string_view Key) const
+  {
+    auto SectionIt = m_File.m_Sections.find(SectionName);
+    if (SectionIt == m_File.m_Sections.end())
+      return std::nullopt;
+
+    const IniSection::entry_map_t &Entries = SectionIt->second.m_Entries;
+
+    auto EntryIt = Entries.find(Key);
+    if (EntryIt == Entries.end())
+      return std::nullopt;
+
+    return std::make_optional(std::cref(EntryIt->second));
+  }
+
+  std::optional<std::reference_wrapper<const IniEntry>> TryGetEntry(const IniKey &Key) const
+  {
+    auto SectionIt = m_File.m_Sections.find(Key.Section.Name, Key.Section.Hash);
+    if (SectionIt == m_File.m_Sections.end())
+      return std::nullopt;
+
+    const IniSection::entry_map_t &Entries = SectionIt->second.m_Entries;
+
+    auto EntryIt = Entries.find(Key.Entry.Name, Key.Entry.Hash);
+    if (EntryIt == Entries.end())
+      return std::nullopt;
+
+    return std::make_optional(std::cref(EntryIt->second));
+  }
+
+  // Edits return false, and change nothing, when a name, key or value cannot
+  // be written (see IniFile::WriteTo) or there is nothing to remove.
+  //
+  // SetValue replaces every value of the entry with Value, rewriting its first
+  // line and dropping its "+Key=" lines. AddValue adds a "+Key=" line after the
+  // last value. Both create the entry after the last entry of the section,
+  // and the section at the end of the file, when they do not exist yet.
+  bool SetValue(std::string_view SectionName, std::string_view Key, std::string_view Value);
+  bool AddValue(std::string_view SectionName, std::string_view Key, std::string_view Value);
+  bool RemoveEntry(std::string_view SectionName, std::string_view Key);
+  bool AddSection(std::string_view SectionName);
+
+  // Removes the section's lines, comments inside its blocks included. Later
+  // blocks with the same name, which the parser ignores, go as well so they
+  // are not read in its place.
+  bool RemoveSection(std::string_view SectionName);
+
+  std::string GetText() const;
+  bool        WriteTo(std::ostream &Out) const;
+  bool        WriteFile(const std::string &FileName) const;
+  void        Clear();
+
+private:
+  struct ScanHandler;
+
+  static constexpr std::uint32_t None = static_cast<std::uint32_t>(-1);
+
+  struct Line
+  {
+    std::string_view Text;  // the line end included
+    std::uint32_t    Next = None;
+    bool             Removed = false;
+  };
+
+  // Header line and last line of one block, up to the blank line ending it
+  struct Block
+  {
+    std::uint32_t First = None;
+    std::uint32_t Last = None;
+  };
+
+  // Lines of the first block holding values of one key, and the line new
+  // entries go after (the last entry line, or the header)
+  struct EntryLines
+  {
+    std::vector<std::uint32_t> Values;
+    std::uint32_t              LastEntry = None;
+  };
+
+  void             Parse();
+  EntryLines       FindEntry(const Block &Lines, std::string_view Key) const;
+  std::uint32_t    AppendLine(std::string_view Text);
+  std::uint32_t    InsertLine(Block &Lines, std::uint32_t After, std::string_view Text);
+  void             EndLine(std::uint32_t Index);
+  std::string_view Store(std::string Text);
+  Block *          FindOrAddSection(std::string_view SectionName);
+  void             RemoveLines(const Block &Lines);
+
+  IniFile           m_File;
+  std::vector<char> m_Buffer;
+  std::string_view  m_NewLine = "\n";
+
+  std::vector<Line>       m_Lines;
+  std::uint32_t           m_FirstLine = None;
+  std::uint32_t           m_LastLine = None;
+  std::deque<std::string> m_EditedText;  // text of new and rewritten lines
+
+  // Blocks of each section, the first is the one IniFile reads. Later blocks
+  // with the same name are ignored by the parser but kept with the section.
+  std::unordered_map<std::string_view, std::vector<Block>> m_Sections;
+};
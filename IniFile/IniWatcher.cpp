@@ -0,0 +1,377 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniWatcher.h"
+
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+#  define INIFILE_HAS_INOTIFY 1
+#  include <cerrno>
+#  include <climits>
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <sys/inotify.h>
+#  include <unistd.h>
+#else
+#  define INIFILE_HAS_INOTIFY 0
+#endif
+
+IniWatcher::IniWatcher(const std::string &FileName, std::chrono::milliseconds PollInterval)
+    : m_FileName(FileName)
+    , m_PollInterval(PollInterval)
+{
+  // Watching starts before the first read, so no change after it is missed
+  if (!StartNotify())
+    StopNotify();
+
+  if (!Reload())
+  {
+    StopNotify();
+    throw std::runtime_error("Failed to read ini file");
+  }
+
+  m_Thread = std::thread([this]() { Run(); });
+}
+
+IniWatcher::~IniWatcher()
+{
+  {
+    std::lock_guard<std::mutex> Lock(m_StopMutex);
+    m_Stop = true;
+  }
+  m_StopCondition.notify_all();
+
+#if INIFILE_HAS_INOTIFY
+  if (m_StopPipe[1] != -1)
+  {
+    const char Wake = 0;
+    while (write(m_StopPipe[1], &Wake, 1) < 0 && errno == EINTR)
+      ;
+  }
+#endif
+
+  m_Thread.join();
+  StopNotify();
+
+  delete m_Published.load();
+}
+
+// Lock free: the published record cannot be freed while a reader is copying
+// from it, because Publish waits for every reader that may have seen it
+std::shared_ptr<const FrozenIni> IniWatcher::GetSnapshot() const
+{
+  for (;;)
+  {
+    const std::uint32_t Epoch = m_Epoch.load();
+    ReaderCount &       Readers = m_Readers[Epoch & 1];
+
+    Readers.Count.fetch_add(1);
+
+    // A reader that saw an epoch Publish has since moved past is not waited
+    // for, so it has to start again in the current one
+    if (m_Epoch.load() == Epoch)
+    {
+      std::shared_ptr<const FrozenIni> Snapshot = m_Published.load()->Snapshot;
+      Readers.Count.fetch_sub(1);
+      return Snapshot;
+    }
+
+    Readers.Count.fetch_sub(1);
+  }
+}
+
+bool IniWatcher::Reload()
+{
+  return Load(false);
+}
+
+const std::string &IniWatcher::GetFileName() const
+{
+  return m_FileName;
+}
+
+IniSubscriptions::Id IniWatcher::Subscribe(std::string_view SectionName, std::string_view Key, IniSubscriptions::EntryCallback Callback)
+{
+  std::lock_guard<std::mutex> Lock(m_SubscriptionMutex);
+  return m_Subscriptions.Subscribe(SectionName, Key, std::move(Callback));
+}
+
+IniSubscriptions::Id IniWatcher::SubscribeSection(std::string_view SectionName, IniSubscriptions::SectionCallback Callback)
+{
+  std::lock_guard<std::mutex> Lock(m_SubscriptionMutex);
+  return m_Subscriptions.SubscribeSection(SectionName, std::move(Callback));
+}
+
+bool IniWatcher::Unsubscribe(IniSubscriptions::Id Subscription)
+{
+  std::lock_guard<std::mutex> Lock(m_SubscriptionMutex);
+  return m_Subscriptions.Unsubscribe(Subscription);
+}
+
+// The watcher thread passes OnlyIfChanged, so touching the file or writing
+// the same contents again publishes nothing
+bool IniWatcher::Load(bool OnlyIfChanged)
+{
+  std::lock_guard<std::mutex> Lock(m_PublishMutex);
+
+  // Read into memory rather than mapped: a file rewritten in place is
+  // truncated first, and touching a mapped page past the new end faults
+  IniMappedFile Contents;
+  if (!Contents.Open(m_FileName, IniReadMode::Buffered))
+    return false;
+
+  const std::string_view Text = Contents.GetView();
+  const std::uint64_t    Hash = IniHashString(Text);
+  if (OnlyIfChanged && Hash == m_LoadedHash)
+    return true;
+
+  // Parsed and frozen before anything is published, readers only ever see a
+  // complete snapshot
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  // Clean, so the next reload's diff reuses the section hashes it takes now
+  Ini.ClearDirty();
+
+  Publish(std::make_shared<const FrozenIni>(Ini.Freeze()));
+  m_LoadedHash = Hash;
+
+  {
+    std::lock_guard<std::mutex> SubscriptionLock(m_SubscriptionMutex);
+    if (!m_Subscriptions.IsEmpty())
+      m_Subscriptions.Dispatch(IniDiff(m_Loaded, Ini));
+  }
+
+  m_Loaded = std::move(Ini);
+  return true;
+}
+
+// Called with m_PublishMutex held
+void IniWatcher::Publish(std::shared_ptr<const FrozenIni> Snapshot)
+{
+  Published *Old = m_Published.exchange(new Published{std::move(Snapshot)});
+  m_Generation.fetch_add(1, std::memory_order_release);
+
+  if (!Old)
+    return;
+
+  // Readers from here on start in the new epoch and can only see the new
+  // record. Once the ones counted in the old epoch are done nobody can be
+  // copying from Old, and readers still holding its snapshot keep it alive.
+  const std::uint32_t Epoch = m_Epoch.fetch_add(1);
+  while (m_Readers[Epoch & 1].Count.load() != 0)
+    std::this_thread::yield();
+
+  delete Old;
+}
+
+#if INIFILE_HAS_INOTIFY
+
+// The directory is watched rather than the file, a file renamed over the
+// watched one would end the watch
+bool IniWatcher::StartNotify()
+{
+  const std::filesystem::path Path(m_FileName);
+  const std::string           Directory = Path.has_parent_path() ? Path.parent_path().string() : std::string(".");
+
+  m_Notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (m_Notify == -1 || pipe2(m_StopPipe, O_CLOEXEC) != 0)
+    return false;
+
+  // Behind a link any entry of its directory can be on the way to the file,
+  // and replacing a link creates or renames one
+  std::error_code Error;
+  m_FollowLink = std::filesystem::is_symlink(std::filesystem::symlink_status(m_FileName, Error));
+
+  m_DirectoryWatch = inotify_add_watch(m_Notify, Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | (m_FollowLink ? IN_CREATE : 0));
+  if (m_DirectoryWatch == -1)
+    return false;
+
+  if (m_FollowLink)
+    WatchTarget();
+
+  return true;
+}
+
+// Called again after every change, the link may point somewhere else by then.
+// IN_MASK_ADD, so a target next to the link keeps the directory's own mask.
+void IniWatcher::WatchTarget()
+{
+  std::error_code             Error;
+  const std::filesystem::path Target = std::filesystem::canonical(m_FileName, Error);
+
+  // A link to nothing for now, the directory watch sees it come back
+  if (Error)
+    return;
+
+  m_TargetName = Target.filename().string();
+
+  const std::string Directory = Target.parent_path().string();
+  if (m_TargetWatch != -1 && Directory == m_TargetDirectory)
+    return;
+
+  // The old directory may be gone already, which ended its watch
+  if (m_TargetWatch != -1 && m_TargetWatch != m_DirectoryWatch)
+    inotify_rm_watch(m_Notify, m_TargetWatch);
+
+  m_TargetWatch = inotify_add_watch(m_Notify, Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MASK_ADD);
+  m_TargetDirectory = (m_TargetWatch != -1) ? Directory : std::string();
+}
+
+void IniWatcher::StopNotify()
+{
+  for (int *Fd : {&m_Notify, &m_StopPipe[0], &m_StopPipe[1]})
+  {
+    if (*Fd != -1)
+      close(*Fd);
+    *Fd = -1;
+  }
+
+  // Closing the descriptor removed the watches
+  m_DirectoryWatch = -1;
+  m_TargetWatch = -1;
+}
+
+void IniWatcher::Run()
+{
+  if (m_Notify == -1)
+  {
+    Poll();
+    return;
+  }
+
+  const std::string Name = std::filesystem::path(m_FileName).filename().string();
+
+  // Room for a few events with the longest name, aligned for the event struct
+  alignas(inotify_event) char Events[16 * (sizeof(inotify_event) + NAME_MAX + 1)];
+
+  for (;;)
+  {
+    pollfd Fds[2] = {{m_Notify, POLLIN, 0}, {m_StopPipe[0], POLLIN, 0}};
+    if (poll(Fds, 2, -1) < 0)
+    {
+      if (errno == EINTR)
+        continue;
+
+      // Giving up would stop reloading for the rest of the process's life
+      Poll();
+      return;
+    }
+
+    if (Fds[1].revents != 0)
+      break;
+
+    // Every pending event is read first, so a burst of writes costs one reload
+    bool Changed = false;
+    for (;;)
+    {
+      const ssize_t Count = read(m_Notify, Events, sizeof(Events));
+      if (Count <= 0)
+        break;
+
+      // An overflowed queue dropped events, any of which may have been the
+      // file's, and the reload compares contents anyway
+      for (const char *Cursor = Events; Cursor < Events + Count;)
+      {
+        const auto *Event = reinterpret_cast<const inotify_event *>(Cursor);
+        const bool  Named = (Event->len > 0);
+
+        if (Event->mask & IN_Q_OVERFLOW)
+          Changed = true;
+        else if (Event->wd == m_DirectoryWatch && (m_FollowLink || (Named && Name == Event->name)))
+          Changed = true;
+        else if (Event->wd == m_TargetWatch && Named && m_TargetName == Event->name)
+          Changed = true;
+
+        Cursor += sizeof(inotify_event) + Event->len;
+      }
+    }
+
+    if (!Changed)
+      continue;
+
+    if (m_FollowLink)
+      WatchTarget();
+
+    Load(true);
+  }
+}
+
+#else
+
+bool IniWatcher::StartNotify()
+{
+  return false;
+}
+
+void IniWatcher::StopNotify()
+{}
+
+void IniWatcher::WatchTarget()
+{}
+
+void IniWatcher::Run()
+{
+  Poll();
+}
+
+#endif
+
+// Fallback without change notifications, reloads when the size or
+// modification time changes. Timestamps can be coarser than the time between
+// two writes, so while the file was modified recently its contents are
+// compared as well.
+void IniWatcher::Poll()
+{
+  using FileClock = std::filesystem::file_time_type::clock;
+
+  auto Stamp = [this]() {
+    std::error_code Error;
+    const auto      Size = std::filesystem::file_size(m_FileName, Error);
+    const auto      Modified = Error ? std::filesystem::file_time_type() : std::filesystem::last_write_time(m_FileName, Error);
+    return std::make_pair(Error ? std::uintmax_t(0) : Size, Modified);
+  };
+
+  auto Last = Stamp();
+
+  std::unique_lock<std::mutex> Lock(m_StopMutex);
+  while (!m_StopCondition.wait_for(Lock, m_PollInterval, [this]() { return m_Stop; }))
+  {
+    const auto Current = Stamp();
+    const bool Recent = (FileClock::now() - Current.second) < std::chrono::seconds(2);
+
+    if ((Current != Last || Recent) && Load(true))
+      Last = Current;
+  }
+}
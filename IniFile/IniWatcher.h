@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "FrozenIni.h"
+#include "IniSharedSnapshot.h"
+#include "IniSubscriptions.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// Keeps an up to date FrozenIni of a file, reloading it when the file changes
+//
+// A background thread waits for the file to change (inotify on Linux, polling
+// its size and modification time elsewhere), reads it into a new FrozenIni and
+// only then publishes it. Readers call GetSnapshot, which never blocks and
+// never takes a lock, and keep using the snapshot they got for as long as
+// they hold it. A published snapshot is never changed, a reload publishes a
+// new one.
+//
+// On Linux the directory is watched for files closed after writing and files
+// renamed into it, so both rewriting the file in place and renaming a new file
+// over it are seen. A full event queue counts as a change, and should waiting
+// for events fail the thread falls back to polling. When the file name is a
+// symbolic link, any file created in or renamed into the link's directory
+// counts (a Kubernetes ConfigMap updates by renaming its "..data" link), and
+// the directory the link currently resolves to is watched for the target. A
+// path that only passes through a linked directory, with a plain file at the
+// end, is not followed that way; watch the link itself. The file is read
+// into memory, not mapped, so a rewrite truncating it mid-read cannot fault
+// the process. Such a reload can still read the file half written and publish
+// that until the rewrite's own close reloads it; renaming a complete file over
+// it is the way to update a file under load without that window. A change
+// that cannot be read (the file is gone, for one) keeps the last snapshot.
+//
+// The last file read is also kept as an IniFile, so each reload can be diffed
+// against it (see IniDiff) and the changes dispatched to subscriptions.
+class IniWatcher
+{
+public:
+  // Reads the file once, throws std::runtime_error when it cannot be read
+  explicit IniWatcher(const std::string &FileName, std::chrono::milliseconds PollInterval = std::chrono::milliseconds(100));
+  ~IniWatcher();
+
+  IniWatcher(const IniWatcher &) = delete;
+  IniWatcher &operator=(const IniWatcher &) = delete;
+
+  // One thread's view of the current snapshot. Get loads the generation and
+  // writes nothing unless a reload was published since the last call, only
+  // then does it take the new snapshot from GetSnapshot. Give each thread
+  // its own.
+  class Reader
+  {
+  public:
+    explicit Reader(const IniWatcher &Watcher)
+        : m_Watcher(&Watcher)
+    {}
+
+    const IniSharedSnapshot &Get()
+    {
+      const std::uint64_t Generation = m_Watcher->GetGeneration();
+      if (Generation != m_Generation)
+      {
+        m_Snapshot = m_Watcher->GetSnapshot();
+        m_Generation = Generation;
+      }
+
+      return m_Snapshot;
+    }
+
+  private:
+    const IniWatcher *m_Watcher;
+    std::uint64_t     m_Generation = 0;
+    IniSharedSnapshot m_Snapshot;
+  };
+
+  std::shared_ptr<const FrozenIni> GetSnapshot() const;
+
+  // Number of snapshots published so far, 1 after construction. Bumped after
+  // the snapshot is published, so a reader that sees a new generation gets at
+  // least that snapshot from GetSnapshot.
+  std::uint64_t GetGeneration() const
+  {
+    return m_Generation.load(std::memory_order_acquire);
+  }
+
+  // Reads the file on the calling thread and publishes it, returns false and
+  // keeps the last snapshot when the file cannot be read
+  bool Reload();
+
+  // Callbacks on changes to one Section.Key or to a whole section, see
+  // IniSubscriptions. They are called on the thread that reloaded, once the
+  // new snapshot is published, and must not call Reload, Subscribe or
+  // Unsubscribe. Nothing is diffed while there are no subscriptions.
+  IniSubscriptions::Id Subscribe(std::string_view SectionName, std::string_view Key, IniSubscriptions::EntryCallback Callback);
+  IniSubscriptions::Id SubscribeSection(std::string_view SectionName, IniSubscriptions::SectionCallback Callback);
+  bool                 Unsubscribe(IniSubscriptions::Id Subscription);
+
+  const std::string &GetFileName() const;
+
+private:
+  struct Published
+  {
+    std::shared_ptr<const FrozenIni> Snapshot;
+  };
+
+  // Readers announce themselves on the counter of the epoch they started in,
+  // on its own cache line so the two counters do not share one
+  struct alignas(64) ReaderCount
+  {
+    std::atomic<std::uint32_t> Count{0};
+  };
+
+  bool Load(bool OnlyIfChanged);
+  void Publish(std::shared_ptr<const FrozenIni> Snapshot);
+  bool StartNotify();
+  void StopNotify();
+  void WatchTarget();
+  void Run();
+  void Poll();
+
+  std::string               m_FileName;
+  std::chrono::milliseconds m_PollInterval;
+
+  std::atomic<Published *>   m_Published{nullptr};
+  std::atomic<std::uint32_t> m_Epoch{0};
+  std::atomic<std::uint64_t> m_Generation{0};
+  mutable ReaderCount        m_Readers[2];
+  std::mutex                 m_PublishMutex;  // between the watcher thread and Reload, readers never take it
+  std::uint64_t              m_LoadedHash = 0;
+  IniFile                    m_Loaded;  // the file behind the published snapshot, guarded by m_PublishMutex
+
+  std::mutex       m_SubscriptionMutex;
+  IniSubscriptions m_Subscriptions;
+
+  std::mutex              m_StopMutex;
+  std::condition_variable m_StopCondition;
+  bool                    m_Stop = false;
+  int                     m_Notify = -1;  // inotify descriptor, -1 when polling
+  int                     m_StopPipe[2] = {-1, -1};
+  int                     m_DirectoryWatch = -1;
+  bool                    m_FollowLink = false;  // the file name is a symbolic link
+  int                     m_TargetWatch = -1;    // the directory the link resolves to
+  std::string             m_TargetDirectory;
+  std::string             m_TargetName;
+  std::thread             m_Thread;
+};
@@ -0,0 +1,265 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "IniFile.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+  // "[Name]" and one line per value, without the blank line that ends it
+  bool AppendSection(std::string &Buffer, std::string_view Name, const IniSection &Section, std::string_view NewLine)
+  {
+    if (!IniScanner::IsWritableSectionName(Name))
+      return false;
+
+    Buffer += '[';
+    Buffer += Name;
+    Buffer += ']';
+    Buffer += NewLine;
+
+    for (auto EntryIt = Section.cbegin(); EntryIt != Section.cend(); ++EntryIt)
+    {
+      const IniEntry &       Entry = EntryIt->second;
+      const std::string_view Key = EntryIt->first;
+
+      if (!IniScanner::IsWritableKey(Key))
+        return false;
+
+      for (std::size_t v = 0; v < Entry.GetValueCount(); ++v)
+      {
+        const std::string_view Value = *Entry.GetValueView(v);
+        if (!IniScanner::IsWritableValue(Value))
+          return false;
+
+        if (v > 0)
+          Buffer += '+';
+        Buffer += Key;
+        Buffer += '=';
+        Buffer += Value;
+        Buffer += NewLine;
+      }
+    }
+
+    return true;
+  }
+
+  bool EndsWithBlankLine(std::string_view Text)
+  {
+    if (Text.empty())
+      return true;
+
+    if (Text.back() != '\n')
+      return false;
+
+    Text.remove_suffix(1);
+    const std::size_t LineStart = Text.rfind('\n');
+    const std::size_t NotSpace = Text.find_first_not_of(" \t\r", LineStart == std::string_view::npos ? 0 : LineStart + 1);
+    return NotSpace == std::string_view::npos;
+  }
+}  // namespace
+
+bool IniFile::WriteText(std::string &Buffer) const
+{
+  Buffer.clear();
+
+  for (auto SectionIt = m_Sections.cbegin(); SectionIt != m_Sections.cend(); ++SectionIt)
+  {
+    if (!AppendSection(Buffer, SectionIt->first, SectionIt->second, "\n"))
+      return false;
+
+    // A blank line ends the section, so the next header is read as one
+    Buffer += '\n';
+  }
+
+  return true;
+}
+
+bool IniFile::WriteTo(std::ostream &Out) const
+{
+  std::string Buffer;
+  if (!WriteText(Buffer))
+    return false;
+
+  Out.write(Buffer.data(), static_cast<std::streamsize>(Buffer.size()));
+  return static_cast<bool>(Out);
+}
+
+// Renamed over the file once it is written in full, see IniReplaceFile
+bool IniFile::WriteFile(const std::string &FileName) const
+{
+  std::string Buffer;
+  if (!WriteText(Buffer))
+    return false;
+
+  return IniReplaceFile(FileName, Buffer);
+}
+
+void IniFile::StampSource(const std::string &FileName)
+{
+  std::error_code Error;
+  const auto      Size = std::filesystem::file_size(FileName, Error);
+  const auto      Modified = Error ? std::filesystem::file_time_type() : std::filesystem::last_write_time(FileName, Error);
+
+  if (Error)
+  {
+    m_Source = SourceFile();
+    return;
+  }
+
+  m_Source.FileName = FileName;
+  m_Source.Size = static_cast<std::size_t>(Size);
+  m_Source.Modified = static_cast<std::int64_t>(Modified.time_since_epoch().count());
+}
+
+bool IniFile::SaveIncremental()
+{
+  if (m_Source.FileName.empty())
+    return false;
+
+  // Read rather than mapped, a mapping of a file someone truncates while it is
+  // copied raises SIGBUS
+  IniMappedFile SourceText;
+  if (!SourceText.Open(m_Source.FileName, IniReadMode::Buffered))
+    return false;
+
+  // Checked by stamp rather than by content, hashing the whole file would cost
+  // as much as writing it out. A read that raced a rewrite can still be short
+  // of a stamp taken after the rewrite, and the ranges would run past it.
+  const std::string_view Source = SourceText.GetView();
+  const SourceFile       Expected = m_Source;
+  StampSource(Expected.FileName);
+  if (m_Source.Size != Expected.Size || m_Source.Modified != Expected.Modified || Source.size() != Expected.Size)
+  {
+    m_Source = Expected;
+    return false;
+  }
+
+  // One walk over the entries decides which sections are rewritten, clean
+  // sections are then neither checked nor cleared again. Dirty only means a
+  // section may have changed, one that hashes the same as its source bytes is
+  // copied like a clean one.
+  std::vector<IniSection *> FromSource;
+  std::vector<IniSection *> Dirty;
+  std::vector<IniSection *> Unchanged;
+  std::vector<IniSection *> Added;
+  for (auto SectionIt = m_Sections.begin(); SectionIt != m_Sections.end(); ++SectionIt)
+  {
+    IniSection &Section = SectionIt->second;
+    if (Section.m_Source.Begin == IniSection::SourceRange::None)
+      Added.push_back(&Section);
+    else
+    {
+      FromSource.push_back(&Section);
+      if (Section.IsDirty())
+        (Section.GetContentHash() == Section.m_Source.Hash ? Unchanged : Dirty).push_back(&Section);
+    }
+  }
+
+  if (Dirty.empty() && Added.empty())
+  {
+    for (IniSection *Section : Unchanged)
+      Section->ClearDirty();
+
+    return true;
+  }
+
+  std::sort(FromSource.begin(), FromSource.end(), [](const IniSection *LHS, const IniSection *RHS) { return LHS->m_Source.Begin < RHS->m_Source.Begin; });
+  std::sort(Dirty.begin(), Dirty.end());
+
+  // Rewritten sections use the file's own line ends
+  const std::string_view NewLine = (Source.find("\r\n") != std::string_view::npos) ? "\r\n" : "\n";
+
+  // Where every section ends up in the saved file, applied once it is written
+  std::vector<IniSection::SourceRange> Saved;
+  Saved.reserve(FromSource.size() + Added.size());
+
+  std::string Out;
+  Out.reserve(Source.size() + Source.size() / 8);
+
+  std::size_t Copied = 0;
+  for (IniSection *Section : FromSource)
+  {
+    const IniSection::SourceRange Range = Section->m_Source;
+    Out.append(Source.data() + Copied, Range.Begin - Copied);
+
+    const std::size_t Begin = Out.size();
+    std::uint64_t     Hash = Range.Hash;
+    if (!std::binary_search(Dirty.begin(), Dirty.end(), Section))
+      Out.append(Source.data() + Range.Begin, Range.End - Range.Begin);
+    else if (AppendSection(Out, Section->GetName(), *Section, NewLine))
+      Hash = Section->GetContentHash();
+    else
+      return false;
+
+    Saved.push_back({Begin, Out.size(), Hash});
+    Copied = Range.End;
+  }
+
+  Out.append(Source.data() + Copied, Source.size() - Copied);
+
+  for (IniSection *Section : Added)
+  {
+    if (!EndsWithBlankLine(Out))
+    {
+      if (Out.back() != '\n')
+        Out += NewLine;
+      Out += NewLine;
+    }
+
+    const std::size_t Begin = Out.size();
+    if (!AppendSection(Out, Section->GetName(), *Section, NewLine))
+      return false;
+
+    Saved.push_back({Begin, Out.size(), Section->GetContentHash()});
+  }
+
+  // Renamed over the source, so a reader never sees a half written file
+  if (!IniReplaceFile(m_Source.FileName, Out))
+    return false;
+
+  for (std::size_t i = 0; i < FromSource.size(); ++i)
+    FromSource[i]->m_Source = Saved[i];
+  for (std::size_t i = 0; i < Added.size(); ++i)
+    Added[i]->m_Source = Saved[FromSource.size() + i];
+
+  for (IniSection *Section : Dirty)
+    Section->ClearDirty();
+  for (IniSection *Section : Unchanged)
+    Section->ClearDirty();
+  for (IniSection *Section : Added)
+    Section->ClearDirty();
+
+  StampSource(m_Source.FileName);
+  return true;
+}
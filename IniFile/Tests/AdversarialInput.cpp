@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <filesystem>
+
+TEST_CASE("Pathological lines are parsed by the scanner", "[scanner][adversarial]")
+{
+  const std::size_t LineLength = 64 * 1024;
+
+  const std::string LongValue(LineLength, 'v');
+  const std::string LongKey(LineLength, 'k');
+
+  std::string ManyEquals;
+  for (std::size_t i = 0; i < LineLength / 2; ++i)
+    ManyEquals += "a=";
+
+  std::string Text = "[Section]\n";
+  Text += "LongValue=" + LongValue + "\n";
+  Text += LongKey + "=Value\n";
+  Text += LongKey + "\n";
+  Text += "ManyEquals=" + ManyEquals + "\n";
+  Text += std::string(LineLength, '=') + "\n";
+  Text += "Last=Value\n";
+
+  const std::string FileName = WriteTempFile("IniFileTest_Adversarial.ini", Text);
+  IniFile           Ini(FileName);
+  std::filesystem::remove(FileName);
+
+  auto Section_Opt = Ini.TryGetSection("Section");
+  REQUIRE(Section_Opt.has_value());
+
+  IniSection &Section = Section_Opt.value().get();
+  REQUIRE(Section.GetNumEntries() == 4);
+
+  SECTION("A 64 KB value is kept whole")
+  {
+    REQUIRE(Section.HasEntry("LongValue"));
+    REQUIRE(Section["LongValue"].TryGetValue().value_or("bad") == LongValue);
+  }
+
+  SECTION("A 64 KB key is kept whole, and the same key without '=' is skipped")
+  {
+    REQUIRE(Section.HasEntry(LongKey));
+    REQUIRE(Section[LongKey].GetValueCount() == 1);
+    REQUIRE(Section[LongKey].TryGetValue().value_or("bad") == "Value");
+  }
+
+  SECTION("Every '=' after the first one belongs to the value")
+  {
+    REQUIRE(Section.HasEntry("ManyEquals"));
+    REQUIRE(Section["ManyEquals"].TryGetValue().value_or("bad") == ManyEquals);
+  }
+
+  SECTION("Entries after the pathological lines are still parsed")
+  {
+    REQUIRE(Section.HasEntry("Last"));
+    REQUIRE(Section["Last"].TryGetValue().value_or("bad") == "Value");
+  }
+}
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  std::atomic<std::size_t> GlobalAllocations{0};
+
+  void *CountedAllocate(std::size_t Size)
+  {
+    GlobalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *Pointer = std::malloc(Size ? Size : 1))
+      return Pointer;
+
+    throw std::bad_alloc();
+  }
+
+  void *CountedAllocate(std::size_t Size, std::align_val_t Alignment)
+  {
+    GlobalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    // aligned_alloc wants the size to be a multiple of the alignment
+    const std::size_t Align = static_cast<std::size_t>(Alignment);
+    const std::size_t Rounded = (Size + Align - 1) / Align * Align;
+
+#if defined(_MSC_VER)
+    if (void *Pointer = _aligned_malloc(Rounded ? Rounded : Align, Align))
+#else
+    if (void *Pointer = std::aligned_alloc(Align, Rounded ? Rounded : Align))
+#endif
+      return Pointer;
+
+    throw std::bad_alloc();
+  }
+
+  void AlignedFree(void *Pointer)
+  {
+#if defined(_MSC_VER)
+    _aligned_free(Pointer);
+#else
+    std::free(Pointer);
+#endif
+  }
+}  // namespace
+
+std::size_t GetGlobalAllocationCount()
+{
+  return GlobalAllocations.load(std::memory_order_relaxed);
+}
+
+void *operator new(std::size_t Size)
+{
+  return CountedAllocate(Size);
+}
+
+void *operator new[](std::size_t Size)
+{
+  return CountedAllocate(Size);
+}
+
+void *operator new(std::size_t Size, const std::nothrow_t &) noexcept
+{
+  GlobalAllocations.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(Size ? Size : 1);
+}
+
+void *operator new[](std::size_t Size, const std::nothrow_t &) noexcept
+{
+  GlobalAllocations.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(Size ? Size : 1);
+}
+
+void operator delete(void *Pointer) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete[](void *Pointer) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete(void *Pointer, std::size_t) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete[](void *Pointer, std::size_t) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete(void *Pointer, const std::nothrow_t &) noexcept
+{
+  std::free(Pointer);
+}
+
+void operator delete[](void *Pointer, const std::nothrow_t &) noexcept
+{
+  std::free(Pointer);
+}
+
+// std::pmr::new_delete_resource goes through the aligned forms, so they have to
+// be counted as well
+void *operator new(std::size_t Size, std::align_val_t Alignment)
+{
+  return CountedAllocate(Size, Alignment);
+}
+
+void *operator new[](std::size_t Size, std::align_val_t Alignment)
+{
+  return CountedAllocate(Size, Alignment);
+}
+
+void operator delete(void *Pointer, std::align_val_t) noexcept
+{
+  AlignedFree(Pointer);
+}
+
+void operator delete[](void *Pointer, std::align_val_t) noexcept
+{
+  AlignedFree(Pointer);
+}
+
+void operator delete(void *Pointer, std::size_t, std::align_val_t) noexcept
+{
+  AlignedFree(Pointer);
+}
+
+void operator delete[](void *Pointer, std::size_t, std::align_val_t) noexcept
+{
+  AlignedFree(Pointer);
+}
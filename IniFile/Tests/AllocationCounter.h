@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+// Counts calls to the global operator new made anywhere in the test executable
+//
+// Tests/AllocationCounter.cpp replaces the global allocation functions, so the
+// count includes every std::string, container node and std::pmr default
+// resource allocation.
+std::size_t GetGlobalAllocationCount();
+
+class AllocationScope
+{
+public:
+  AllocationScope()
+      : m_Start(GetGlobalAllocationCount())
+  {}
+
+  std::size_t GetCount() const
+  {
+    return GetGlobalAllocationCount() - m_Start;
+  }
+
+private:
+  std::size_t m_Start;
+};
+
+// memory_resource that counts the allocations it passes on to Upstream
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+  explicit CountingResource(std::pmr::memory_resource *Upstream = std::pmr::new_delete_resource())
+      : m_Upstream(Upstream)
+  {}
+
+  std::size_t GetAllocationCount() const
+  {
+    return m_Allocations;
+  }
+
+  std::size_t GetBytesAllocated() const
+  {
+    return m_Bytes;
+  }
+
+  std::size_t GetLiveAllocations() const
+  {
+    return m_Allocations - m_Deallocations;
+  }
+
+  std::size_t GetLiveBytes() const
+  {
+    return m_Bytes - m_BytesDeallocated;
+  }
+
+private:
+  void *do_allocate(std::size_t Bytes, std::size_t Alignment) override
+  {
+    ++m_Allocations;
+    m_Bytes += Bytes;
+    return m_Upstream->allocate(Bytes, Alignment);
+  }
+
+  void do_deallocate(void *Pointer, std::size_t Bytes, std::size_t Alignment) override
+  {
+    ++m_Deallocations;
+    m_BytesDeallocated += Bytes;
+    m_Upstream->deallocate(Pointer, Bytes, Alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &Other) const noexcept override
+  {
+    return this == &Other;
+  }
+
+  std::pmr::memory_resource *m_Upstream;
+  std::size_t                m_Allocations = 0;
+  std::size_t                m_Deallocations = 0;
+  std::size_t                m_Bytes = 0;
+  std::size_t                m_BytesDeallocated = 0;
+};
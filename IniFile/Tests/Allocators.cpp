@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniMappedFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <array>
+
+TEST_CASE("A whole file can be parsed into a monotonic arena", "[allocator][pmr]")
+{
+  const char *FileNames[] = {"EntryLists.ini", "EntryListWithMessyComments.ini", "MessyComments.ini", "SimpleMultipleSections.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniMappedFile Contents;
+    REQUIRE(Contents.Open(TestFileDirectory + FileName));
+
+    // The arena has no upstream, so anything that does not fit would throw, and
+    // nothing may fall back to the global heap
+    alignas(std::max_align_t) std::array<char, 64 * 1024> Storage;
+    std::pmr::monotonic_buffer_resource Arena(Storage.data(), Storage.size(), std::pmr::null_memory_resource());
+
+    std::size_t GlobalAllocations = 0;
+    {
+      AllocationScope Scope;
+
+      IniFile Ini(&Arena);
+      Ini.ParseBuffer(Contents.GetView());
+
+      GlobalAllocations = Scope.GetCount();
+
+      IniFile Expected(TestFileDirectory + FileName);
+      RequireSameContents(Expected, Ini);
+    }
+
+    REQUIRE(GlobalAllocations == 0);
+  }
+}
+
+TEST_CASE("Allocations per parse are reported by a counting resource", "[allocator][pmr]")
+{
+  IniMappedFile Contents;
+  REQUIRE(Contents.Open(TestFileDirectory + "EntryLists.ini"));
+
+  CountingResource Counting;
+  std::size_t      PerParse = 0;
+
+  {
+    IniFile Ini(&Counting);
+    Ini.ParseBuffer(Contents.GetView());
+    PerParse = Counting.GetAllocationCount();
+
+    REQUIRE(PerParse > 0);
+    REQUIRE(Ini.get_allocator().resource() == &Counting);
+  }
+
+  // Everything is handed back to the resource when the file goes away
+  REQUIRE(Counting.GetLiveAllocations() == 0);
+
+  SECTION("A monotonic arena turns them into a handful of upstream allocations")
+  {
+    CountingResource                    Upstream;
+    std::pmr::monotonic_buffer_resource Arena(&Upstream);
+
+    IniFile Ini(&Arena);
+    Ini.ParseBuffer(Contents.GetView());
+
+    REQUIRE(Upstream.GetAllocationCount() < PerParse);
+  }
+}
+
+TEST_CASE("Sections and entries use the resource of their owner", "[allocator][pmr]")
+{
+  CountingResource First;
+  CountingResource Second;
+
+  IniFile Ini(&First);
+  Ini.ParseBuffer("[Section]\nList=Value1\n+List=Value2\n");
+
+  IniSection &Section = Ini.TryGetSection("Section").value().get();
+  REQUIRE(Section.get_allocator().resource() == &First);
+  REQUIRE(Section["List"].get_allocator().resource() == &First);
+  REQUIRE(Section.CreateEntry("Created").get_allocator().resource() == &First);
+
+  SECTION("Allocator-extended copies move everything to the new resource")
+  {
+    IniEntry Copy(Section["List"], &Second);
+    REQUIRE(Copy.get_allocator().resource() == &Second);
+    REQUIRE(Copy.GetValues() == Section["List"].GetValues());
+    REQUIRE(Copy.GetValues().get_allocator().resource() == &Second);
+  }
+
+  SECTION("Entries with different resources can be swapped")
+  {
+    IniEntry Other(std::string_view("Other"), std::string_view("OtherValue"), &Second);
+    Other.Swap(Section["List"]);
+
+    REQUIRE(Other.GetKey() == "List");
+    REQUIRE(Other.GetValueCount() == 2);
+    REQUIRE(Other.get_allocator().resource() == &Second);
+    REQUIRE(Section["List"].GetKey() == "Other");
+    REQUIRE(Section["List"].TryGetValue().value_or("bad") == "OtherValue");
+    REQUIRE(Section["List"].get_allocator().resource() == &First);
+  }
+}
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+TEST_CASE("A cached file loads the same contents as parsing it", "[cache]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  const std::string CacheFileName = TempFilePath("IniFileTest_Cache.bin");
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile Parsed(TestFileDirectory + FileName);
+    REQUIRE(Parsed.WriteCache(TestFileDirectory + FileName, CacheFileName));
+
+    IniFile Cached;
+    REQUIRE(Cached.ReadCache(TestFileDirectory + FileName, CacheFileName));
+    RequireSameContents(Parsed, Cached);
+    RequireSameContents(Cached, Parsed);
+  }
+
+  std::filesystem::remove(CacheFileName);
+}
+
+TEST_CASE("Stale and damaged caches are refused", "[cache]")
+{
+  const std::string SourceName = "IniFileTest_CacheSource.ini";
+  const std::string SourceFileName = WriteTempFile(SourceName, "[Server]\nHost=localhost\nPort=8080\n");
+  const std::string CacheFileName = TempFilePath("IniFileTest_CacheSource.bin");
+
+  std::filesystem::remove(CacheFileName);
+
+  IniFile Parsed(SourceFileName);
+  REQUIRE(Parsed.WriteCache(SourceFileName, CacheFileName));
+
+  SECTION("A missing cache")
+  {
+    IniFile Cached;
+    REQUIRE_FALSE(Cached.ReadCache(SourceFileName, CacheFileName + ".missing"));
+  }
+
+  SECTION("A source file that changed size")
+  {
+    WriteTempFile(SourceName, "[Server]\nHost=localhost\nPort=80\n");
+
+    IniFile Cached;
+    REQUIRE_FALSE(Cached.ReadCache(SourceFileName, CacheFileName));
+    REQUIRE(Cached.cbegin() == Cached.cend());
+  }
+
+  SECTION("A source file edited without changing its size or time")
+  {
+    const auto Modified = std::filesystem::last_write_time(SourceFileName);
+    WriteTempFile(SourceName, "[Server]\nHost=localhost\nPort=9090\n");
+    std::filesystem::last_write_time(SourceFileName, Modified);
+
+    IniFile Cached;
+    REQUIRE_FALSE(Cached.ReadCache(SourceFileName, CacheFileName));
+  }
+
+  SECTION("A truncated cache")
+  {
+    std::filesystem::resize_file(CacheFileName, std::filesystem::file_size(CacheFileName) - 3);
+
+    IniFile Cached;
+    REQUIRE_FALSE(Cached.ReadCache(SourceFileName, CacheFileName));
+    REQUIRE(Cached.cbegin() == Cached.cend());
+  }
+
+  SECTION("ReadFileCached parses and rewrites a stale cache")
+  {
+    WriteTempFile(SourceName, "[Server]\nHost=example.com\n");
+
+    IniFile Cached;
+    REQUIRE(Cached.ReadFileCached(SourceFileName, CacheFileName));
+    REQUIRE(Cached.TryGetSection("Server")->get()["Host"].TryGetValue().value_or("bad") == "example.com");
+
+    IniFile Reloaded;
+    REQUIRE(Reloaded.ReadCache(SourceFileName, CacheFileName));
+    RequireSameContents(Cached, Reloaded);
+  }
+
+  std::filesystem::remove(SourceFileName);
+  std::filesystem::remove(CacheFileName);
+}
+
+TEST_CASE("ReadFileCached stamps the cache with the text it parsed", "[cache]")
+{
+  // Same size and, once the time is put back, same modification time, so only
+  // the content hash tells them apart
+  const std::string Texts[] = {"[Server]\nPort=1111\n", "[Server]\nPort=2222\n"};
+  const std::string Ports[] = {"1111", "2222"};
+
+  const std::string SourceName = "IniFileTest_CacheRace.ini";
+  const std::string SourceFileName = WriteTempFile(SourceName, Texts[0]);
+  const std::string CacheFileName = TempFilePath("IniFileTest_CacheRace.bin");
+  const auto Modified = std::filesystem::last_write_time(SourceFileName);
+
+  // The writer rewrites the file in place while Writing is set, the mutex
+  // lets the checks wait for a rewrite in progress to finish
+  std::mutex        WriterMutex;
+  std::atomic<bool> Writing{false};
+  std::atomic<bool> Done{false};
+  std::thread       Writer([&]() {
+    for (std::size_t i = 0; !Done; ++i)
+    {
+      {
+        std::lock_guard<std::mutex> Lock(WriterMutex);
+        if (Writing)
+        {
+          WriteTempFile(SourceName, Texts[i % 2]);
+
+          std::error_code Error;
+          std::filesystem::last_write_time(SourceFileName, Modified, Error);
+        }
+      }
+
+      std::this_thread::yield();
+    }
+  });
+
+  for (int Round = 0; Round < 500; ++Round)
+  {
+    std::filesystem::remove(CacheFileName);
+
+    Writing = true;
+    {
+      IniFile Ini;
+      Ini.ReadFileCached(SourceFileName, CacheFileName);
+    }
+    Writing = false;
+    std::lock_guard<std::mutex> Lock(WriterMutex);
+
+    // Whichever text the cache was stamped with, it has to hold that text
+    for (int t = 0; t < 2; ++t)
+    {
+      WriteTempFile(SourceName, Texts[t]);
+      std::filesystem::last_write_time(SourceFileName, Modified);
+
+      IniFile Cached;
+      if (Cached.ReadCache(SourceFileName, CacheFileName))
+        REQUIRE(Cached.TryGetSection("Server")->get()["Port"].TryGetValue().value_or("bad") == Ports[t]);
+    }
+  }
+
+  Done = true;
+  Writer.join();
+
+  std::filesystem::remove(SourceFileName);
+  std::filesystem::remove(CacheFileName);
+}
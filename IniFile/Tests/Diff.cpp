@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniDiff.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <filesystem>
+
+namespace
+{
+  using Change = IniDiff::Change;
+
+  const std::string Original = "[Server]\n"
+                               "Host=localhost\n"
+                               "Port=8080\n"
+                               "\n"
+                               "[Timeouts]\n"
+                               "RequestMs=250\n"
+                               "+RequestMs=500\n"
+                               "+RequestMs=1000\n"
+                               "\n"
+                               "[Logging]\n"
+                               "Level=Info\n";
+
+  const IniDiff::SectionChange *FindSection(const IniDiff &Diff, std::string_view Name)
+  {
+    for (const IniDiff::SectionChange &Section : Diff.GetSections())
+      if (Section.Name == Name)
+        return &Section;
+
+    return nullptr;
+  }
+
+  const IniDiff::EntryChange *FindEntry(const IniDiff::SectionChange &Section, std::string_view Key)
+  {
+    for (const IniDiff::EntryChange &Entry : Section.Entries)
+      if (Entry.Key == Key)
+        return &Entry;
+
+    return nullptr;
+  }
+}  // namespace
+
+TEST_CASE("Files with the same contents have an empty diff", "[diff]")
+{
+  const IniFile Old = Parse(Original);
+
+  REQUIRE(IniDiff(Old, Parse(Original)).IsEmpty());
+  REQUIRE(IniDiff(IniFile(), IniFile()).IsEmpty());
+
+  // Neither the order of sections nor of entries counts, nor comments and layout
+  const IniFile Reordered = Parse("[Logging] ; moved up\n"
+                                  "Level=Info\n"
+                                  "\n"
+                                  "[Timeouts]\n"
+                                  "+RequestMs=250\n"
+                                  "RequestMs=500\n"
+                                  "RequestMs=1000\n"
+                                  "\n"
+                                  "[Server]\n"
+                                  "Port=8080   # moved up\n"
+                                  "Host=localhost\n");
+
+  REQUIRE(IniDiff(Old, Reordered).IsEmpty());
+}
+
+TEST_CASE("Added, removed and modified sections and entries", "[diff]")
+{
+  const IniFile Old = Parse(Original);
+  const IniFile New = Parse("[Server]\n"
+                            "Host=example.com\n"
+                            "Port=8080\n"
+                            "Backlog=64\n"
+                            "\n"
+                            "[Timeouts]\n"
+                            "RequestMs=250\n"
+                            "+RequestMs=500\n"
+                            "+RequestMs=1000\n"
+                            "\n"
+                            "[Cache]\n"
+                            "SizeMb=128\n"
+                            "+SizeMb=256\n");
+
+  const IniDiff Diff(Old, New);
+  REQUIRE(Diff.GetSections().size() == 3);
+  REQUIRE(Diff.GetNumEntryChanges() == 4);
+
+  // Timeouts is unchanged and left out
+  REQUIRE(FindSection(Diff, "Timeouts") == nullptr);
+
+  const IniDiff::SectionChange *Server = FindSection(Diff, "Server");
+  REQUIRE(Server != nullptr);
+  REQUIRE(Server->Kind == Change::Modified);
+  REQUIRE(Server->Entries.size() == 2);
+
+  const IniDiff::EntryChange *Host = FindEntry(*Server, "Host");
+  REQUIRE(Host != nullptr);
+  REQUIRE(Host->Kind == Change::Modified);
+  REQUIRE(Host->Values.size() == 1);
+  REQUIRE(Host->Values[0].Kind == Change::Modified);
+  REQUIRE(Host->Values[0].Index == 0);
+  REQUIRE(Host->Values[0].OldValue == "localhost");
+  REQUIRE(Host->Values[0].NewValue == "example.com");
+
+  const IniDiff::EntryChange *Backlog = FindEntry(*Server, "Backlog");
+  REQUIRE(Backlog != nullptr);
+  REQUIRE(Backlog->Kind == Change::Added);
+  REQUIRE(Backlog->Values.size() == 1);
+  REQUIRE(Backlog->Values[0].NewValue == "64");
+
+  const IniDiff::SectionChange *Cache = FindSection(Diff, "Cache");
+  REQUIRE(Cache != nullptr);
+  REQUIRE(Cache->Kind == Change::Added);
+  REQUIRE(Cache->Entries.size() == 1);
+  REQUIRE(Cache->Entries[0].Kind == Change::Added);
+  REQUIRE(Cache->Entries[0].Values.size() == 2);
+  REQUIRE(Cache->Entries[0].Values[1].Kind == Change::Added);
+  REQUIRE(Cache->Entries[0].Values[1].Index == 1);
+  REQUIRE(Cache->Entries[0].Values[1].NewValue == "256");
+
+  // Sections removed from the old file come last
+  const IniDiff::SectionChange &Logging = Diff.GetSections().back();
+  REQUIRE(Logging.Name == "Logging");
+  REQUIRE(Logging.Kind == Change::Removed);
+  REQUIRE(Logging.Entries.size() == 1);
+  REQUIRE(Logging.Entries[0].Kind == Change::Removed);
+  REQUIRE(Logging.Entries[0].Values[0].OldValue == "Info");
+  REQUIRE(Logging.Entries[0].Values[0].NewValue.empty());
+
+  // The other way around every change is reversed
+  const IniDiff Reverse(New, Old);
+  REQUIRE(FindSection(Reverse, "Cache")->Kind == Change::Removed);
+  REQUIRE(FindSection(Reverse, "Logging")->Kind == Change::Added);
+  REQUIRE(FindEntry(*FindSection(Reverse, "Server"), "Backlog")->Kind == Change::Removed);
+}
+
+TEST_CASE("List values are compared by position", "[diff]")
+{
+  const IniFile Old = Parse("[Timeouts]\nRequestMs=250\n+RequestMs=500\n+RequestMs=1000\n");
+
+  SECTION("A changed value")
+  {
+    const IniDiff Diff(Old, Parse("[Timeouts]\nRequestMs=250\n+RequestMs=750\n+RequestMs=1000\n"));
+    REQUIRE(Diff.GetNumEntryChanges() == 1);
+
+    const IniDiff::EntryChange &Entry = Diff.GetSections()[0].Entries[0];
+    REQUIRE(Entry.Kind == Change::Modified);
+    REQUIRE(Entry.Values.size() == 1);
+    REQUIRE(Entry.Values[0].Kind == Change::Modified);
+    REQUIRE(Entry.Values[0].Index == 1);
+    REQUIRE(Entry.Values[0].OldValue == "500");
+    REQUIRE(Entry.Values[0].NewValue == "750");
+  }
+
+  SECTION("Values added to and removed from the end")
+  {
+    const IniDiff Longer(Old, Parse("[Timeouts]\nRequestMs=250\n+RequestMs=500\n+RequestMs=1000\n+RequestMs=2000\n"));
+    const IniDiff::EntryChange &Added = Longer.GetSections()[0].Entries[0];
+    REQUIRE(Added.Kind == Change::Modified);
+    REQUIRE(Added.Values.size() == 1);
+    REQUIRE(Added.Values[0].Kind == Change::Added);
+    REQUIRE(Added.Values[0].Index == 3);
+    REQUIRE(Added.Values[0].NewValue == "2000");
+
+    const IniDiff Shorter(Old, Parse("[Timeouts]\nRequestMs=250\n"));
+    const IniDiff::EntryChange &Removed = Shorter.GetSections()[0].Entries[0];
+    REQUIRE(Removed.Values.size() == 2);
+    REQUIRE(Removed.Values[0].Kind == Change::Removed);
+    REQUIRE(Removed.Values[0].Index == 1);
+    REQUIRE(Removed.Values[1].Index == 2);
+    REQUIRE(Removed.Values[1].OldValue == "1000");
+  }
+
+  SECTION("Swapped values")
+  {
+    const IniDiff Diff(Old, Parse("[Timeouts]\nRequestMs=500\n+RequestMs=250\n+RequestMs=1000\n"));
+    REQUIRE(Diff.GetSections()[0].Entries[0].Values.size() == 2);
+  }
+}
+
+TEST_CASE("Content hashes follow edits to a file read from disk", "[diff]")
+{
+  const std::string FileName = WriteTempFile("IniFileTest_Diff.ini", Original);
+
+  IniFile Ini(FileName);
+  IniFile Unchanged = Parse(Original);
+  REQUIRE(IniDiff(Unchanged, Ini).IsEmpty());
+
+  // ReadFile builds the hashes while scanning, they match hashing afterwards
+  for (auto it = Ini.cbegin(); it != Ini.cend(); ++it)
+    REQUIRE(it->second.GetContentHash() == Unchanged.TryGetSection(it->first)->get().GetContentHash());
+
+  IniSection &Server = Ini.TryGetSection("Server").value().get();
+  const std::uint64_t Before = Server.GetContentHash();
+
+  Server["Port"].RemoveValue(0);
+  Server["Port"].AddValue("9090");
+  REQUIRE(Server.GetContentHash() != Before);
+
+  // Clearing the dirty state must not bring the old hash back
+  Ini.ClearDirty();
+  REQUIRE(Server.GetContentHash() != Before);
+
+  const IniDiff Diff(Unchanged, Ini);
+  REQUIRE(Diff.GetNumEntryChanges() == 1);
+  REQUIRE(Diff.GetSections()[0].Entries[0].Values[0].NewValue == "9090");
+
+  // Changing it back gives the same hash again
+  Server["Port"].RemoveValue(0);
+  Server["Port"].AddValue("8080");
+  REQUIRE(Server.GetContentHash() == Before);
+  REQUIRE(IniDiff(Unchanged, Ini).IsEmpty());
+
+  std::filesystem::remove(FileName);
+}
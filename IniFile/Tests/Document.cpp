@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniDocument.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/TestConfig.h>
+
+namespace
+{
+  bool IsSliceOf(std::string_view Slice, std::string_view Text)
+  {
+    return Slice.data() >= Text.data() && Slice.data() + Slice.size() <= Text.data() + Text.size();
+  }
+}  // namespace
+
+TEST_CASE("An IniDocument holds the same contents as an IniFile", "[document][parse]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniDocument Document;
+    REQUIRE(Document.ReadFile(TestFileDirectory + FileName));
+
+    IniFile Ini(TestFileDirectory + FileName);
+    REQUIRE(Document.GetNumSections() == static_cast<std::size_t>(std::distance(Ini.begin(), Ini.end())));
+
+    for (auto &SectionPair : Ini)
+    {
+      auto Section_Opt = Document.TryGetSection(SectionPair.first);
+      REQUIRE(Section_Opt.has_value());
+      REQUIRE(Section_Opt->GetNumEntries() == SectionPair.second.GetNumEntries());
+
+      for (auto &EntryPair : SectionPair.second)
+      {
+        auto Entry_Opt = Section_Opt->TryGetEntry(EntryPair.first);
+        REQUIRE(Entry_Opt.has_value());
+        REQUIRE(Entry_Opt->GetValueCount() == EntryPair.second.GetValueCount());
+
+        std::size_t ValIndex = 0;
+        for (std::string_view Value : *Entry_Opt)
+          REQUIRE(Value == EntryPair.second.GetValues()[ValIndex++]);
+      }
+    }
+  }
+}
+
+TEST_CASE("IniDocument hands out slices of the text it owns", "[document][zerocopy]")
+{
+  IniDocument Document;
+  Document.ParseBuffer("[Section1]\nList=\"Value1\"\nOther=x\n+List=(Value2) #comment\n");
+
+  const std::string_view Text = Document.GetText();
+
+  auto Section_Opt = Document.TryGetSection("Section1");
+  REQUIRE(Section_Opt.has_value());
+  REQUIRE(IsSliceOf(Section_Opt->GetName(), Text));
+
+  auto List_Opt = Section_Opt->TryGetEntry("List");
+  REQUIRE(List_Opt.has_value());
+  REQUIRE(IsSliceOf(List_Opt->GetKey(), Text));
+  REQUIRE(List_Opt->GetValueCount() == 2);
+  REQUIRE(List_Opt->TryGetValue().value_or("bad") == R"("Value1")");
+  REQUIRE((*List_Opt)[1].value_or("bad") == "(Value2)");
+  REQUIRE_FALSE((*List_Opt)[2].has_value());
+
+  for (std::string_view Value : *List_Opt)
+    REQUIRE(IsSliceOf(Value, Text));
+
+  SECTION("Entries iterate in file order")
+  {
+    std::vector<std::string_view> Keys;
+    for (auto Entry : *Section_Opt)
+      Keys.push_back(Entry.GetKey());
+
+    REQUIRE(Keys == std::vector<std::string_view>{"List", "Other"});
+  }
+
+  SECTION("Slices stay valid when the document is moved")
+  {
+    const std::string_view Value = List_Opt->TryGetValue().value();
+
+    IniDocument Moved(std::move(Document));
+    REQUIRE(Moved.GetText().data() == Text.data());
+    REQUIRE(Value == R"("Value1")");
+    REQUIRE(Moved.TryGetSection("Section1")->TryGetEntry("Other")->TryGetValue().value_or("bad") == "x");
+  }
+
+  SECTION("Missing sections and entries are reported")
+  {
+    REQUIRE_FALSE(Document.HasSection("Section2"));
+    REQUIRE_FALSE(Document.TryGetSection("Section2").has_value());
+    REQUIRE_FALSE(Section_Opt->HasEntry("Missing"));
+    REQUIRE_FALSE(Section_Opt->TryGetEntry("Missing").has_value());
+  }
+}
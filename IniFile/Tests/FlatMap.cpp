@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFlatMap.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using StringMap = IniFlatMap<std::pmr::string, int>;
+
+static void RequireSameContents(const std::unordered_map<std::string, int> &Expected, const StringMap &Actual)
+{
+  REQUIRE(Actual.size() == Expected.size());
+  REQUIRE(static_cast<std::size_t>(std::distance(Actual.begin(), Actual.end())) == Expected.size());
+
+  for (const auto &Pair : Expected)
+  {
+    auto it = Actual.find(std::pmr::string(Pair.first));
+    REQUIRE(it != Actual.end());
+    REQUIRE(it->second == Pair.second);
+  }
+}
+
+TEST_CASE("IniFlatMap inserts, finds and erases keys", "[flatmap]")
+{
+  StringMap Map;
+
+  REQUIRE(Map.empty());
+  REQUIRE(Map.find("Missing") == Map.end());
+
+  REQUIRE(Map.try_emplace("One", 1).second);
+  REQUIRE(Map.try_emplace("Two", 2).second);
+  REQUIRE_FALSE(Map.try_emplace("One", 100).second);
+
+  REQUIRE(Map.size() == 2);
+  REQUIRE(Map.at("One") == 1);
+  REQUIRE(Map.count("Two") == 1);
+  REQUIRE_THROWS_AS(Map.at("Three"), std::out_of_range);
+
+  SECTION("Pairs are iterated in insertion order")
+  {
+    REQUIRE(Map.begin()->first == "One");
+    REQUIRE(std::next(Map.begin())->first == "Two");
+  }
+
+  SECTION("Erasing moves the last pair into the hole")
+  {
+    Map.try_emplace("Three", 3);
+
+    REQUIRE(Map.erase("One") == 1);
+    REQUIRE(Map.erase("One") == 0);
+    REQUIRE(Map.begin()->first == "Three");
+    REQUIRE(Map.at("Three") == 3);
+    REQUIRE(Map.at("Two") == 2);
+    REQUIRE(Map.find("One") == Map.end());
+  }
+
+  SECTION("Clearing leaves an empty, reusable map")
+  {
+    Map.clear();
+    REQUIRE(Map.empty());
+    REQUIRE(Map.bucket_count() == 0);
+    REQUIRE(Map.try_emplace("One", 1).second);
+    REQUIRE(Map.at("One") == 1);
+  }
+}
+
+TEST_CASE("IniFlatMap matches std::unordered_map under random inserts and erases", "[flatmap]")
+{
+  std::unordered_map<std::string, int> Expected;
+  StringMap                            Actual;
+  std::mt19937                         Random(1234);
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    const std::string Key = "Key" + std::to_string(Random() % 3000);
+
+    if (Random() % 3 == 0)
+    {
+      REQUIRE(Actual.erase(std::pmr::string(Key)) == Expected.erase(Key));
+    }
+    else
+    {
+      const bool Inserted = Expected.try_emplace(Key, i).second;
+      REQUIRE(Actual.try_emplace(std::pmr::string(Key), i).second == Inserted);
+    }
+  }
+
+  RequireSameContents(Expected, Actual);
+  REQUIRE(Actual.load_factor() <= 0.8f);
+
+  SECTION("Erasing through iterators")
+  {
+    for (auto it = Actual.begin(); it != Actual.end();)
+    {
+      if (it->second % 2 == 0)
+      {
+        Expected.erase(std::string(it->first));
+        it = Actual.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    RequireSameContents(Expected, Actual);
+  }
+
+  SECTION("Copies and moves keep every pair")
+  {
+    const StringMap Copy(Actual);
+    RequireSameContents(Expected, Copy);
+
+    StringMap Moved(std::move(Actual));
+    RequireSameContents(Expected, Moved);
+    REQUIRE(Actual.empty());
+
+    Actual = std::move(Moved);
+    RequireSameContents(Expected, Actual);
+  }
+}
+
+TEST_CASE("IniFlatMap allocates from its memory_resource", "[flatmap][pmr]")
+{
+  CountingResource Counting;
+  {
+    StringMap Map(&Counting);
+    Map.reserve(100);
+
+    const std::size_t AfterReserve = Counting.GetAllocationCount();
+    REQUIRE(AfterReserve == 2);
+    REQUIRE(Map.bucket_count() * 4 / 5 >= 100);
+
+    for (int i = 0; i < 100; ++i)
+      Map.try_emplace(std::pmr::string("Key" + std::to_string(i), &Counting), i);
+
+    REQUIRE(Counting.GetAllocationCount() == AfterReserve);
+    REQUIRE(Map.begin()->first.get_allocator().resource() == &Counting);
+  }
+
+  REQUIRE(Counting.GetLiveAllocations() == 0);
+}
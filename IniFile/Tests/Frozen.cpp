@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/FrozenIni.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+#include <IniFile/Tests/TestConfig.h>
+
+#include <string>
+
+namespace
+{
+  std::string MakeText(std::size_t NumSections, std::size_t EntriesPerSection)
+  {
+    std::string Text;
+    for (std::size_t s = 0; s < NumSections; ++s)
+    {
+      Text += "[Section" + std::to_string(s) + "]\n";
+      for (std::size_t e = 0; e < EntriesPerSection; ++e)
+        Text += "Key" + std::to_string(e) + "=Value" + std::to_string(s * EntriesPerSection + e) + "\n";
+      Text += "+Key0=Appended\n\n";
+    }
+
+    return Text;
+  }
+
+  void RequireSameContents(const IniFile &Ini, const FrozenIni &Frozen)
+  {
+    REQUIRE(Frozen.GetNumSections() == static_cast<std::size_t>(std::distance(Ini.cbegin(), Ini.cend())));
+
+    std::size_t NumEntries = 0;
+    for (auto SectionIt = Ini.cbegin(); SectionIt != Ini.cend(); ++SectionIt)
+    {
+      auto Section_Opt = Frozen.TryGetSection(SectionIt->first);
+      REQUIRE(Section_Opt.has_value());
+      REQUIRE(Section_Opt->GetName() == SectionIt->first);
+      REQUIRE(Section_Opt->GetNumEntries() == SectionIt->second.GetNumEntries());
+      NumEntries += SectionIt->second.GetNumEntries();
+
+      for (auto EntryIt = SectionIt->second.cbegin(); EntryIt != SectionIt->second.cend(); ++EntryIt)
+      {
+        auto Entry_Opt = Frozen.TryGetEntry(SectionIt->first, EntryIt->first);
+        REQUIRE(Entry_Opt.has_value());
+        REQUIRE(Entry_Opt->GetKey() == EntryIt->first);
+        REQUIRE(Entry_Opt->GetSectionName() == SectionIt->first);
+        REQUIRE(Entry_Opt->GetValueCount() == EntryIt->second.GetValueCount());
+        REQUIRE(Section_Opt->TryGetEntry(EntryIt->first)->GetKey() == EntryIt->first);
+
+        for (std::size_t v = 0; v < EntryIt->second.GetValueCount(); ++v)
+          REQUIRE(Entry_Opt->GetValueView(v) == EntryIt->second.GetValueView(v));
+      }
+    }
+
+    REQUIRE(Frozen.GetNumEntries() == NumEntries);
+  }
+}  // namespace
+
+TEST_CASE("A FrozenIni holds the same contents as the IniFile it was frozen from", "[frozen]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile Ini(TestFileDirectory + FileName);
+    RequireSameContents(Ini, Ini.Freeze());
+  }
+
+  SECTION("Large generated files")
+  {
+    for (std::size_t NumSections : {1, 7, 300})
+    {
+      IniFile Ini;
+      Ini.ParseBuffer(MakeText(NumSections, 3000 / NumSections));
+      RequireSameContents(Ini, Ini.Freeze());
+    }
+  }
+}
+
+TEST_CASE("FrozenIni lookups", "[frozen]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\n"
+                  "Host=localhost\n"
+                  "Port=8080\n"
+                  "Verbose=yes\n"
+                  "+Verbose=no\n"
+                  "\n"
+                  "[Timeouts]\n"
+                  "RequestMs=250\n"
+                  "Scale=1.5\n");
+
+  const FrozenIni Frozen = Ini.Freeze();
+
+  SECTION("Missing names are not found")
+  {
+    REQUIRE_FALSE(Frozen.HasSection("Missing"));
+    REQUIRE_FALSE(Frozen.TryGetEntry("Server", "Missing").has_value());
+    REQUIRE_FALSE(Frozen.TryGetEntry("Missing", "Port").has_value());
+    REQUIRE_FALSE(Frozen.TryGetEntry("Timeouts", "Port").has_value());
+    REQUIRE_FALSE(Frozen.TryGetEntry(IniKey("Timeouts", "Host")).has_value());
+    REQUIRE_FALSE(Frozen.TryGetSection("Server")->HasEntry("RequestMs"));
+  }
+
+  SECTION("Typed values and lists")
+  {
+    REQUIRE(Frozen.TryGetEntry("Server", "Port")->GetInt() == 8080);
+    REQUIRE(Frozen.TryGetEntry("Timeouts", "Scale")->GetDouble() == 1.5);
+    REQUIRE(Frozen.TryGetEntry("Server", "Verbose")->GetBool(0) == true);
+    REQUIRE(Frozen.TryGetEntry("Server", "Verbose")->GetBool(1) == false);
+    REQUIRE_FALSE(Frozen.TryGetEntry("Server", "Host")->GetInt().has_value());
+    REQUIRE_FALSE(Frozen.TryGetEntry("Server", "Port")->GetValueView(1).has_value());
+  }
+
+  SECTION("Hashed names find the same entries")
+  {
+    static constexpr IniKey        RequestMs("Timeouts", "RequestMs");
+    static constexpr IniHashedName Port("Port");
+
+    REQUIRE(Frozen.TryGetEntry(RequestMs)->TryGetValueView() == "250");
+    REQUIRE(Frozen.TryGetSection(IniHashedName("Server"))->TryGetEntry(Port)->GetInt() == 8080);
+  }
+
+  SECTION("Entries iterate in file order")
+  {
+    std::string Keys;
+    for (FrozenIni::EntryView Entry : *Frozen.TryGetSection("Server"))
+      Keys += std::string(Entry.GetKey()) + ",";
+
+    REQUIRE(Keys == "Host,Port,Verbose,");
+  }
+
+  SECTION("Lookups do not allocate")
+  {
+    std::size_t Found = 0;
+    std::size_t Allocations = 0;
+    {
+      AllocationScope Scope;
+      for (int i = 0; i < 100; ++i)
+      {
+        Found += Frozen.TryGetEntry("Server", "Port").has_value();
+        Found += Frozen.TryGetEntry(IniKey("Timeouts", "RequestMs")).has_value();
+        Found += Frozen.TryGetEntry("Server", "Missing").has_value();
+      }
+      Allocations = Scope.GetCount();
+    }
+
+    REQUIRE(Found == 200);
+    REQUIRE(Allocations == 0);
+  }
+
+  SECTION("Moving keeps the contents and leaves an empty FrozenIni")
+  {
+    FrozenIni Moved = Ini.Freeze();
+    FrozenIni Target(std::move(Moved));
+
+    REQUIRE(Target.TryGetEntry("Server", "Host")->TryGetValueView() == "localhost");
+    REQUIRE(Moved.GetNumSections() == 0);
+    REQUIRE_FALSE(Moved.TryGetEntry("Server", "Host").has_value());
+  }
+}
+
+TEST_CASE("An empty IniFile freezes to an empty FrozenIni", "[frozen]")
+{
+  const FrozenIni Frozen = IniFile().Freeze();
+
+  REQUIRE(Frozen.GetNumSections() == 0);
+  REQUIRE(Frozen.GetNumEntries() == 0);
+  REQUIRE_FALSE(Frozen.HasSection(""));
+  REQUIRE_FALSE(Frozen.TryGetEntry("Section", "Key").has_value());
+}
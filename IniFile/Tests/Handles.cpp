@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <string>
+
+static const char *const Text = "[Server]\n"
+                                "Host=localhost\n"
+                                "Port=8080\n"
+                                "\n"
+                                "[Timeouts]\n"
+                                "RequestMs=250\n"
+                                "ConnectMs=1000\n";
+
+TEST_CASE("Handles read back the entry they were resolved for", "[handle]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  const IniEntryHandle Port = Ini.Resolve("Server", "Port");
+  const IniEntryHandle Request = Ini.Resolve(IniKey("Timeouts", "RequestMs"));
+
+  REQUIRE(Ini.IsValid(Port));
+  REQUIRE(Ini.IsValid(Request));
+  REQUIRE(&Ini.TryGetEntry(Port).value().get() == &Ini.TryGetSection("Server")->get()["Port"]);
+  REQUIRE(Ini.TryGetEntry(Request).value().get().TryGetValue().value_or("bad") == "250");
+
+  SECTION("Missing paths resolve to handles that never read")
+  {
+    REQUIRE_FALSE(Ini.IsValid(Ini.Resolve("Server", "Missing")));
+    REQUIRE_FALSE(Ini.IsValid(Ini.Resolve("Missing", "Port")));
+    REQUIRE_FALSE(Ini.IsValid(IniEntryHandle()));
+    REQUIRE_FALSE(Ini.TryGetEntry(IniEntryHandle()).has_value());
+  }
+
+  SECTION("Reading through a handle does not allocate")
+  {
+    std::size_t Allocations = 0;
+    {
+      AllocationScope Scope;
+      for (int i = 0; i < 100; ++i)
+        Ini.TryGetEntry(Port).value().get().GetValueCount();
+      Allocations = Scope.GetCount();
+    }
+
+    REQUIRE(Allocations == 0);
+  }
+}
+
+TEST_CASE("Handles survive inserts and are invalidated by removals", "[handle]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  const IniEntryHandle Port = Ini.Resolve("Server", "Port");
+  IniSection &         Server = Ini.TryGetSection("Server").value().get();
+
+  SECTION("Adding entries and sections keeps handles valid")
+  {
+    for (int i = 0; i < 100; ++i)
+      Server["Added" + std::to_string(i)].AddValue("Value");
+
+    // Enough sections to grow the section table several times over
+    std::string MoreSections;
+    for (int i = 0; i < 100; ++i)
+      MoreSections += "[Added" + std::to_string(i) + "]\nKey=Value\n\n";
+    Ini.ParseBuffer(MoreSections);
+
+    REQUIRE(Ini.IsValid(Port));
+    REQUIRE(Ini.TryGetEntry(Port).value().get().GetKey() == "Port");
+    REQUIRE(Ini.TryGetEntry(Port).value().get().TryGetValue().value_or("bad") == "8080");
+  }
+
+  SECTION("Changing values keeps handles valid")
+  {
+    Ini.TryGetEntry(Port).value().get().Clear();
+    Ini.TryGetEntry(Port).value().get().AddValue("9090");
+
+    REQUIRE(Ini.TryGetEntry(Port).value().get().TryGetValue().value_or("bad") == "9090");
+  }
+
+  SECTION("Removing an entry of the section invalidates the handle")
+  {
+    Server.RemoveEntry("Host");
+
+    REQUIRE_FALSE(Ini.IsValid(Port));
+    REQUIRE_FALSE(Ini.TryGetEntry(Port).has_value());
+
+    const IniEntryHandle Resolved = Ini.Resolve("Server", "Port");
+    REQUIRE(Ini.TryGetEntry(Resolved).value().get().GetKey() == "Port");
+  }
+
+  SECTION("Removing a missing entry changes nothing")
+  {
+    Server.RemoveEntry("Missing");
+    REQUIRE(Ini.IsValid(Port));
+  }
+
+  SECTION("Clearing the section invalidates the handle")
+  {
+    Server.Clear();
+    REQUIRE_FALSE(Ini.IsValid(Port));
+  }
+
+  SECTION("Entries in other sections are unaffected")
+  {
+    const IniEntryHandle Request = Ini.Resolve("Timeouts", "RequestMs");
+    Server.RemoveEntry("Host");
+
+    REQUIRE(Ini.IsValid(Request));
+    REQUIRE(Ini.TryGetEntry(Request).value().get().GetKey() == "RequestMs");
+  }
+}
+
+TEST_CASE("Handles and values survive the file growing", "[handle]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  // Removing an entry moves the section's generation on from where a new map
+  // starts, and a long value lives in its own buffer
+  IniSection &Server = Ini.TryGetSection("Server")->get();
+  Server["Banner"].AddValue(std::string(100, 'b'));
+  Server.RemoveEntry("Host");
+
+  const IniEntryHandle Banner = Ini.Resolve("Server", "Banner");
+  const char *const    BannerValue = Server["Banner"].GetValues()[0].data();
+
+  std::string More;
+  for (int i = 0; i < 1000; ++i)
+    More += "[Section" + std::to_string(i) + "]\nKey=Value\n\n";
+  Ini.ParseBuffer(More);
+
+  // Growing moved the sections rather than copying them, and the handle
+  // still reads the same entry
+  REQUIRE(Ini.IsValid(Banner));
+  REQUIRE(Ini.TryGetEntry(Banner).value().get().GetValues()[0].data() == BannerValue);
+}
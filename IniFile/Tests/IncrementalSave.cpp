@@ -0,0 +1,397 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace
+{
+  const std::string Original = "# Operator maintained, keep the comments\n"
+                               "[Server]  ; main listener\n"
+                               "Host=localhost   # trailing comment\n"
+                               "Port=8080\n"
+                               "; between sections\n"
+                               "\n"
+                               "\n"
+                               "[Timeouts]\n"
+                               "RequestMs=250\n"
+                               "+RequestMs=500\n"
+                               "\n"
+                               "# the end\n";
+}  // namespace
+
+TEST_CASE("Dirty state follows changes to sections and entries", "[incremental][dirty]")
+{
+  const std::string FileName = WriteTempFile("IniFileTest_Dirty.ini", Original);
+
+  IniFile Ini(FileName);
+  REQUIRE_FALSE(Ini.IsDirty());
+
+  IniSection &Server = Ini.TryGetSection("Server").value().get();
+  IniSection &Timeouts = Ini.TryGetSection("Timeouts").value().get();
+
+  SECTION("Reading does not dirty anything")
+  {
+    REQUIRE(Server["Port"].GetInt() == 8080);
+    REQUIRE(Server.HasEntry("Host"));
+    REQUIRE_FALSE(Ini.IsDirty());
+  }
+
+  SECTION("Changing a value dirties the entry and its section only")
+  {
+    Server["Port"].Clear();
+    Server["Port"].AddValue("9090");
+
+    REQUIRE(Server["Port"].IsDirty());
+    REQUIRE_FALSE(Server["Host"].IsDirty());
+    REQUIRE(Server.IsDirty());
+    REQUIRE_FALSE(Timeouts.IsDirty());
+    REQUIRE(Ini.IsDirty());
+
+    Ini.ClearDirty();
+    REQUIRE_FALSE(Ini.IsDirty());
+  }
+
+  SECTION("Adding and removing entries dirties the section")
+  {
+    Timeouts.RemoveEntry("RequestMs");
+    REQUIRE(Timeouts.IsDirty());
+    REQUIRE_FALSE(Server.IsDirty());
+
+    Server.CreateEntry("Threads");
+    REQUIRE(Server.IsDirty());
+  }
+
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("SaveIncremental rewrites only what changed", "[incremental]")
+{
+  const std::string Name = "IniFileTest_Incremental.ini";
+  const std::string FileName = WriteTempFile(Name, Original);
+
+  IniFile Ini(FileName);
+
+  SECTION("Nothing changed, nothing written")
+  {
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == Original);
+  }
+
+  SECTION("A changed value rewrites its section and keeps every other byte")
+  {
+    IniEntry &Request = Ini.TryGetSection("Timeouts")->get()["RequestMs"];
+    Request.RemoveValue(1);
+    Request.AddValue("750");
+
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == "# Operator maintained, keep the comments\n"
+                                      "[Server]  ; main listener\n"
+                                      "Host=localhost   # trailing comment\n"
+                                      "Port=8080\n"
+                                      "; between sections\n"
+                                      "\n"
+                                      "\n"
+                                      "[Timeouts]\n"
+                                      "RequestMs=250\n"
+                                      "+RequestMs=750\n"
+                                      "\n"
+                                      "# the end\n");
+    REQUIRE_FALSE(Ini.IsDirty());
+
+    SECTION("A second save splices into the saved file")
+    {
+      Ini.TryGetSection("Server")->get()["Port"].AddValue("8081");
+      REQUIRE(Ini.SaveIncremental());
+
+      IniFile Expected;
+      Expected.ParseBuffer(ReadFileContents(FileName));
+      RequireSameContents(Expected, Ini);
+
+      const std::string Saved = ReadFileContents(FileName);
+      REQUIRE(Saved.find("Port=8080\n+Port=8081\n; between sections\n") != std::string::npos);
+      REQUIRE(Saved.find("+RequestMs=750\n\n# the end\n") != std::string::npos);
+    }
+  }
+
+  SECTION("New sections are added at the end")
+  {
+    Ini.ParseBuffer("[Added]\nKey=Value\n");
+
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == Original + "\n[Added]\nKey=Value\n");
+
+    IniFile Reread(FileName);
+    RequireSameContents(Ini, Reread);
+  }
+
+  SECTION("A source changed since it was read is left alone")
+  {
+    WriteTempFile(Name, Original + "; edited by someone else\n");
+    Ini.TryGetSection("Server")->get()["Port"].AddValue("1");
+
+    REQUIRE_FALSE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == Original + "; edited by someone else\n");
+  }
+
+  SECTION("Files without a source cannot be saved incrementally")
+  {
+    IniFile FromBuffer;
+    FromBuffer.ParseBuffer(Original);
+    REQUIRE_FALSE(FromBuffer.SaveIncremental());
+  }
+
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("Iterating values without changing them rewrites nothing", "[incremental]")
+{
+  const std::string Contents = "[A]\n"
+                               "; keep this comment\n"
+                               "k=1\n"
+                               "+k=2\n";
+  const std::string FileName = WriteTempFile("IniFileTest_IncrementalIterate.ini", Contents);
+
+  IniFile   Ini(FileName);
+  IniEntry &Entry = Ini.TryGetSection("A")->get()["k"];
+
+  std::size_t NumValues = 0;
+  for (std::pmr::string &Value : Entry)
+    NumValues += !Value.empty();
+
+  REQUIRE(NumValues == 2);
+  REQUIRE(Ini.IsDirty());
+
+  SECTION("The section is copied as it was")
+  {
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == Contents);
+    REQUIRE_FALSE(Ini.IsDirty());
+  }
+
+  SECTION("A value changed through an iterator is still written")
+  {
+    *Entry.begin() = "3";
+
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == "[A]\nk=3\n+k=2\n");
+    REQUIRE_FALSE(Ini.IsDirty());
+  }
+
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("A file loaded from its cache saves incrementally", "[incremental][cache]")
+{
+  const std::string FileName = WriteTempFile("IniFileTest_IncrementalCached.ini", Original);
+  const std::string CacheFileName = TempFilePath("IniFileTest_IncrementalCached.bin");
+  std::filesystem::remove(CacheFileName);
+
+  const std::string Expected = "# Operator maintained, keep the comments\n"
+                               "[Server]  ; main listener\n"
+                               "Host=localhost   # trailing comment\n"
+                               "Port=8080\n"
+                               "; between sections\n"
+                               "\n"
+                               "\n"
+                               "[Timeouts]\n"
+                               "RequestMs=250\n"
+                               "+RequestMs=750\n"
+                               "\n"
+                               "# the end\n";
+
+  auto ChangeAndSave = [](IniFile &Ini) {
+    IniEntry &Request = Ini.TryGetSection("Timeouts")->get()["RequestMs"];
+    Request.RemoveValue(1);
+    Request.AddValue("750");
+    return Ini.SaveIncremental();
+  };
+
+  SECTION("Parsed by ReadFileCached")
+  {
+    IniFile Parsed;
+    REQUIRE(Parsed.ReadFileCached(FileName, CacheFileName));
+    REQUIRE_FALSE(Parsed.IsDirty());
+    REQUIRE(ChangeAndSave(Parsed));
+    REQUIRE(ReadFileContents(FileName) == Expected);
+  }
+
+  SECTION("Loaded from the cache")
+  {
+    {
+      IniFile Parsed;
+      REQUIRE(Parsed.ReadFileCached(FileName, CacheFileName));
+    }
+
+    IniFile Cached;
+    REQUIRE(Cached.ReadCache(FileName, CacheFileName));
+    REQUIRE_FALSE(Cached.IsDirty());
+    REQUIRE(ChangeAndSave(Cached));
+    REQUIRE(ReadFileContents(FileName) == Expected);
+  }
+
+  SECTION("A cache written from changed contents loads clean but has no source")
+  {
+    IniFile Changed(FileName);
+    Changed.TryGetSection("Server")->get()["Port"].AddValue("8081");
+    REQUIRE(Changed.WriteCache(FileName, CacheFileName));
+
+    IniFile Cached;
+    REQUIRE(Cached.ReadCache(FileName, CacheFileName));
+    REQUIRE_FALSE(Cached.IsDirty());
+    REQUIRE_FALSE(Cached.SaveIncremental());
+    REQUIRE(ReadFileContents(FileName) == Original);
+  }
+
+  std::filesystem::remove(FileName);
+  std::filesystem::remove(CacheFileName);
+}
+
+TEST_CASE("SaveIncremental keeps the file's permissions and links", "[incremental]")
+{
+  SECTION("An owner-only file stays owner-only")
+  {
+    const std::string FileName = WriteTempFile("IniFileTest_IncrementalSecret.ini", Original);
+
+    const auto Owner = std::filesystem::perms::owner_read | std::filesystem::perms::owner_write;
+    std::filesystem::permissions(FileName, Owner, std::filesystem::perm_options::replace);
+
+    IniFile Ini(FileName);
+    Ini.TryGetSection("Server")->get()["Port"].AddValue("9090");
+    REQUIRE(Ini.SaveIncremental());
+
+    REQUIRE((std::filesystem::status(FileName).permissions() & std::filesystem::perms::mask) == Owner);
+    REQUIRE(CountTempFilesFor(FileName) == 0);
+    std::filesystem::remove(FileName);
+  }
+
+  SECTION("A symbolic link keeps pointing at the saved file")
+  {
+    const std::string TargetName = WriteTempFile("IniFileTest_IncrementalTarget.ini", Original);
+    const std::string LinkName = TempFilePath("IniFileTest_IncrementalLink.ini");
+    std::filesystem::remove(LinkName);
+    std::filesystem::create_symlink(TargetName, LinkName);
+
+    IniFile Ini(LinkName);
+    Ini.ParseBuffer("[Added]\nKey=Value\n");
+    REQUIRE(Ini.SaveIncremental());
+
+    REQUIRE(std::filesystem::is_symlink(std::filesystem::symlink_status(LinkName)));
+    REQUIRE(ReadFileContents(TargetName) == Original + "\n[Added]\nKey=Value\n");
+
+    // The saved file is the new source, through the link
+    Ini.TryGetSection("Server")->get()["Port"].AddValue("9090");
+    REQUIRE(Ini.SaveIncremental());
+    REQUIRE(ReadFileContents(TargetName).find("Port=8080\n+Port=9090\n") != std::string::npos);
+
+    REQUIRE(CountTempFilesFor(TargetName) == 0);
+    std::filesystem::remove(LinkName);
+    std::filesystem::remove(TargetName);
+  }
+}
+
+TEST_CASE("SaveIncremental survives the file being rewritten in place", "[incremental][stress]")
+{
+  const std::string Name = "IniFileTest_IncrementalInPlace.ini";
+  const std::string FileName = TempFilePath(Name);
+
+  // Large enough that a save is often still copying when the next rewrite
+  // truncates the file
+  std::string Contents;
+  for (int s = 0; s < 256; ++s)
+    Contents += "# section " + std::to_string(s) + "\n[Section" + std::to_string(s) + "]\nKey=" + std::string(64, 'v') + "\n\n";
+
+  // The writer puts the modification time back after every rewrite, so the
+  // source stamp still matches whenever a rewrite is not in progress. It only
+  // runs during the saves, reading the file is not what is tested here.
+  std::mutex        WriterMutex;
+  std::atomic<bool> Writing{false};
+  std::atomic<bool> Done{false};
+  std::thread       Writer([&]() {
+    while (!Done)
+    {
+      {
+        std::lock_guard<std::mutex> Lock(WriterMutex);
+        if (Writing)
+        {
+          const auto Modified = std::filesystem::last_write_time(FileName);
+          WriteTempFile(Name, Contents);
+
+          std::error_code Error;
+          std::filesystem::last_write_time(FileName, Modified, Error);
+        }
+      }
+
+      std::this_thread::yield();
+    }
+  });
+
+  // A save may be refused or copy a half written file, it must not crash
+  for (int Round = 0; Round < 300; ++Round)
+  {
+    IniFile Ini;
+    {
+      std::lock_guard<std::mutex> Lock(WriterMutex);
+      WriteTempFile(Name, Contents);
+      Ini.ReadFile(FileName);
+      Writing = true;
+    }
+
+    Ini.ParseBuffer("[Added]\nKey=Value\n");
+    Ini.SaveIncremental();
+    Writing = false;
+  }
+
+  Done = true;
+  Writer.join();
+
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("SaveIncremental keeps CRLF line ends", "[incremental]")
+{
+  const std::string FileName = WriteTempFile("IniFileTest_IncrementalCRLF.ini", "[First]\r\nKey=1\r\n\r\n[Second]\r\nKey=2\r\n");
+
+  IniFile Ini(FileName);
+  Ini.TryGetSection("Second")->get()["Other"].AddValue("3");
+
+  REQUIRE(Ini.SaveIncremental());
+  REQUIRE(ReadFileContents(FileName) == "[First]\r\nKey=1\r\n\r\n[Second]\r\nKey=2\r\nOther=3\r\n");
+
+  std::filesystem::remove(FileName);
+}
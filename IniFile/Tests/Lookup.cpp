@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+
+// Names longer than any small string buffer, so a temporary key would allocate
+static const char *const Text = "[AVeryLongSectionNameThatDoesNotFitInline]\n"
+                                "AVeryLongEntryKeyThatDoesNotFitInline=Value1\n"
+                                "+AVeryLongEntryKeyThatDoesNotFitInline=Value2\n"
+                                "AnotherVeryLongEntryKeyThatDoesNotFitInline=Value3\n";
+
+TEST_CASE("Lookups accept any string type", "[lookup]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  const std::string      SectionName = "AVeryLongSectionNameThatDoesNotFitInline";
+  const std::string_view SectionView = SectionName;
+  const std::pmr::string SectionPmr(SectionName);
+
+  REQUIRE(Ini.HasSection(SectionName));
+  REQUIRE(Ini.HasSection(SectionView));
+  REQUIRE(Ini.HasSection(SectionPmr));
+  REQUIRE(Ini.HasSection("AVeryLongSectionNameThatDoesNotFitInline"));
+  REQUIRE_FALSE(Ini.HasSection(SectionView.substr(1)));
+
+  IniSection &Section = Ini.TryGetSection(SectionView).value().get();
+  REQUIRE(&Section == &Ini.TryGetSection(SectionName).value().get());
+
+  REQUIRE(Section.HasEntry("AVeryLongEntryKeyThatDoesNotFitInline"));
+  REQUIRE(Section.TryGetEntry(std::string("AVeryLongEntryKeyThatDoesNotFitInline")).value().get().GetValueCount() == 2);
+  REQUIRE(Section["AnotherVeryLongEntryKeyThatDoesNotFitInline"].TryGetValue().value_or("bad") == "Value3");
+  REQUIRE_FALSE(Section.TryGetEntry("Missing").has_value());
+}
+
+TEST_CASE("Lookups with string views and literals do not allocate", "[lookup][allocator]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  const std::string_view SectionName = "AVeryLongSectionNameThatDoesNotFitInline";
+  const std::string_view EntryKey = "AVeryLongEntryKeyThatDoesNotFitInline";
+  const std::string_view MissingKey = "AVeryLongEntryKeyThatIsNotInTheSection";
+
+  std::size_t Allocations = 0;
+  std::size_t Found = 0;
+  {
+    AllocationScope Scope;
+
+    Found += Ini.HasSection(SectionName);
+    Found += Ini.HasSection("AVeryLongSectionNameThatIsNotInTheFile");
+
+    IniSection &Section = Ini.TryGetSection(SectionName).value().get();
+    Found += Ini.TryGetSection("AVeryLongSectionNameThatDoesNotFitInline").has_value();
+
+    Found += Section.HasEntry(EntryKey);
+    Found += Section.HasEntry(MissingKey);
+    Found += Section.TryGetEntry(EntryKey).has_value();
+    Found += Section.TryGetEntry(MissingKey).has_value();
+    Found += Section[EntryKey].GetValueCount();
+    Found += Section["AnotherVeryLongEntryKeyThatDoesNotFitInline"].GetValueCount();
+
+    Section.RemoveEntry(MissingKey);
+    Section.RemoveEntry("AnotherVeryLongEntryKeyThatDoesNotFitInline");
+
+    Allocations = Scope.GetCount();
+  }
+
+  REQUIRE(Found == 7);
+  REQUIRE(Allocations == 0);
+  REQUIRE(Ini.TryGetSection(SectionName).value().get().GetNumEntries() == 1);
+}
+
+TEST_CASE("Missing keys are created in the section's resource", "[lookup][allocator]")
+{
+  // Keep the section's own allocations off the global heap
+  alignas(std::max_align_t) std::array<char, 16 * 1024> Storage;
+  std::pmr::monotonic_buffer_resource Arena(Storage.data(), Storage.size(), std::pmr::null_memory_resource());
+  CountingResource                    Counting(&Arena);
+
+  IniFile Ini(&Counting);
+  Ini.ParseBuffer(Text);
+
+  IniSection &Section = Ini.TryGetSection("AVeryLongSectionNameThatDoesNotFitInline").value().get();
+
+  std::size_t GlobalAllocations = 0;
+  {
+    AllocationScope Scope;
+
+    Section["AVeryLongEntryKeyThatWasNotInTheFile"].AddValue("Value");
+    Section.CreateEntry("AnotherVeryLongEntryKeyThatWasNotInTheFile");
+
+    GlobalAllocations = Scope.GetCount();
+  }
+
+  REQUIRE(GlobalAllocations == 0);
+  REQUIRE(Counting.GetAllocationCount() > 0);
+  REQUIRE(Section.GetNumEntries() == 4);
+
+  for (auto &EntryPair : Section)
+  {
+    REQUIRE(EntryPair.first.get_allocator().resource() == &Counting);
+    REQUIRE(EntryPair.second.get_allocator().resource() == &Counting);
+    REQUIRE(EntryPair.first == EntryPair.second.GetKey());
+  }
+}
+
+TEST_CASE("Hashed names and keys find the same sections and entries", "[lookup][hashedkey]")
+{
+  // Both hashes are computed by the compiler
+  static constexpr IniKey        EntryKey("AVeryLongSectionNameThatDoesNotFitInline", "AVeryLongEntryKeyThatDoesNotFitInline");
+  static constexpr IniKey        MissingEntry("AVeryLongSectionNameThatDoesNotFitInline", "Missing");
+  static constexpr IniKey        MissingSection("Missing", "AVeryLongEntryKeyThatDoesNotFitInline");
+  static constexpr IniHashedName SectionName("AVeryLongSectionNameThatDoesNotFitInline");
+
+  static_assert(SectionName.Hash == EntryKey.Section.Hash, "Hashes are computed at compile time");
+  static_assert(IniStringHash{}("Port") != IniStringHash{}("port"), "Hashes are computed at compile time");
+
+  REQUIRE(SectionName.Hash == IniStringHash{}(std::string("AVeryLongSectionNameThatDoesNotFitInline")));
+
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+
+  REQUIRE(Ini.HasSection(SectionName));
+  REQUIRE(&Ini.TryGetSection(SectionName).value().get() == &Ini.TryGetSection(SectionName.Name).value().get());
+
+  IniSection &Section = Ini.TryGetSection(SectionName).value().get();
+  REQUIRE(Section.HasEntry(EntryKey.Entry));
+  REQUIRE_FALSE(Section.HasEntry(MissingEntry.Entry));
+
+  auto Entry_Opt = Ini.TryGetEntry(EntryKey);
+  REQUIRE(Entry_Opt.has_value());
+  REQUIRE(&Entry_Opt.value().get() == &Section[EntryKey.Entry.Name]);
+
+  REQUIRE_FALSE(Ini.TryGetEntry(MissingEntry).has_value());
+  REQUIRE_FALSE(Ini.TryGetEntry(MissingSection).has_value());
+  REQUIRE_FALSE(Ini.HasSection(MissingSection.Section));
+
+  std::size_t Allocations = 0;
+  {
+    AllocationScope Scope;
+    Ini.TryGetEntry(EntryKey);
+    Ini.TryGetEntry(MissingEntry);
+    Allocations = Scope.GetCount();
+  }
+
+  REQUIRE(Allocations == 0);
+}
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniMappedFile.h>
+#include <IniFile/Tests/TestConfig.h>
+
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+  std::string ReadWithStream(const std::string &FileName)
+  {
+    std::ifstream In(FileName, std::ios_base::in | std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(In), std::istreambuf_iterator<char>());
+  }
+}  // namespace
+
+TEST_CASE("Files can be viewed through IniMappedFile with every read mode", "[file][mmap]")
+{
+  const std::string FileName = TestFileDirectory + "EntryLists.ini";
+  const std::string Expected = ReadWithStream(FileName);
+  REQUIRE_FALSE(Expected.empty());
+
+  for (IniReadMode Mode : {IniReadMode::Buffered, IniReadMode::Mapped, IniReadMode::MappedSequential, IniReadMode::MappedPopulate})
+  {
+    IniMappedFile File;
+    REQUIRE(File.Open(FileName, Mode));
+    REQUIRE(File.GetView() == Expected);
+
+#if defined(__unix__) || defined(__APPLE__)
+    REQUIRE(File.IsMapped() == (Mode != IniReadMode::Buffered));
+#endif
+
+    IniFile Ini(FileName, IniParseMode::Scanner, Mode);
+    REQUIRE(Ini.GetReadMode() == Mode);
+
+    auto Sec3_Opt = Ini.TryGetSection("Section3");
+    REQUIRE(Sec3_Opt.has_value());
+    REQUIRE(Sec3_Opt.value().get().GetNumEntries() == 2);
+    REQUIRE(Sec3_Opt.value().get()["List2"].GetValueCount() == 4);
+  }
+}
+
+TEST_CASE("IniMappedFile reports missing files and can be moved", "[file][mmap]")
+{
+  IniMappedFile Missing;
+  REQUIRE_FALSE(Missing.Open(TestFileDirectory + "DoesNotExist.ini"));
+  REQUIRE(Missing.GetView().empty());
+
+  IniMappedFile File;
+  REQUIRE(File.Open(TestFileDirectory + "Simple.ini"));
+  const std::string Expected(File.GetView());
+
+  IniMappedFile Moved(std::move(File));
+  REQUIRE(Moved.GetView() == Expected);
+  REQUIRE(File.GetView().empty());
+
+  Moved.Close();
+  REQUIRE(Moved.GetView().empty());
+  REQUIRE_FALSE(Moved.IsMapped());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+TEST_CASE("Pipes fall back to buffered reads", "[file][mmap][pipe]")
+{
+  const std::string FifoName = "/tmp/IniFileTest_" + std::to_string(::getpid()) + ".fifo";
+  REQUIRE(::mkfifo(FifoName.c_str(), 0600) == 0);
+
+  // Larger than one 64 KB read so the buffer has to grow
+  std::string Contents = "[Section]\n";
+  for (int i = 0; i < 10000; ++i)
+    Contents += "Key" + std::to_string(i) + "=Value" + std::to_string(i) + "\n";
+
+  std::thread Writer([&]() {
+    std::ofstream Out(FifoName, std::ios_base::out | std::ios_base::binary);
+    Out << Contents;
+  });
+
+  IniMappedFile File;
+  const bool    Opened = File.Open(FifoName, IniReadMode::MappedPopulate);
+  Writer.join();
+  ::unlink(FifoName.c_str());
+
+  REQUIRE(Opened);
+  REQUIRE_FALSE(File.IsMapped());
+  REQUIRE(File.GetView() == Contents);
+}
+
+#endif
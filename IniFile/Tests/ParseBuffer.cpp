@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniMappedFile.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+TEST_CASE("An ini file can be parsed from an in-memory buffer", "[buffer][parse][sections][lists]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(R"(# Embedded config
+[Server]
+Host=localhost ;comment
+Port=8080
+Aliases=alpha
++Aliases="beta"
+
+[Client]
+Retries=3
+)");
+
+  auto Server_Opt = Ini.TryGetSection("Server");
+  auto Client_Opt = Ini.TryGetSection("Client");
+
+  REQUIRE(Server_Opt.has_value());
+  REQUIRE(Client_Opt.has_value());
+  REQUIRE(Ini.GetFileName().empty());
+
+  IniSection &Server = Server_Opt.value().get();
+  REQUIRE(Server.GetNumEntries() == 3);
+  REQUIRE(Server["Host"].TryGetValue().value_or("bad") == "localhost");
+  REQUIRE(Server["Port"].TryGetValue().value_or("bad") == "8080");
+  REQUIRE(Server["Aliases"].GetValueCount() == 2);
+  REQUIRE(Server["Aliases"][1].value_or("bad") == R"("beta")");
+
+  IniSection &Client = Client_Opt.value().get();
+  REQUIRE(Client.GetNumEntries() == 1);
+  REQUIRE(Client["Retries"].TryGetValue().value_or("bad") == "3");
+}
+
+TEST_CASE("Parsing a buffer gives the same contents as parsing the file it came from", "[buffer][parse]")
+{
+  const char *FileNames[] = {"EntryLists.ini", "EntryListWithMessyComments.ini", "MessyComments.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniMappedFile Contents;
+    REQUIRE(Contents.Open(TestFileDirectory + FileName));
+
+    IniFile FromBuffer;
+    FromBuffer.ParseBuffer(Contents.GetView());
+
+    IniFile FromFile(TestFileDirectory + FileName);
+    RequireSameContents(FromFile, FromBuffer);
+  }
+}
+
+TEST_CASE("An empty buffer gives an empty file", "[buffer][parse]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(std::string_view());
+
+  REQUIRE(Ini.begin() == Ini.end());
+  REQUIRE_FALSE(Ini.HasSection("Section"));
+}
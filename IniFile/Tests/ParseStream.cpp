@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniMappedFile.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <utility>
+
+namespace
+{
+  // Hands out Text and then fails, the way a read error on a device does
+  class FailingBuffer : public std::streambuf
+  {
+  public:
+    explicit FailingBuffer(std::string InText)
+        : m_Text(std::move(InText))
+    {
+      setg(m_Text.data(), m_Text.data(), m_Text.data() + m_Text.size());
+    }
+
+  protected:
+    int_type underflow() override
+    {
+      throw std::runtime_error("read error");
+    }
+
+  private:
+    std::string m_Text;
+  };
+}  // namespace
+
+TEST_CASE("An ini file can be parsed from a std::istream", "[stream][parse][sections][lists]")
+{
+  std::istringstream In("[Section1]\nKey=Value #comment\nList=A\n+List=B\n\n[Section2]\nOther=(1,2,3)");
+
+  IniFile Ini;
+  REQUIRE(Ini.ParseStream(In));
+
+  auto Sec1_Opt = Ini.TryGetSection("Section1");
+  auto Sec2_Opt = Ini.TryGetSection("Section2");
+
+  REQUIRE(Sec1_Opt.has_value());
+  REQUIRE(Sec2_Opt.has_value());
+
+  IniSection &Sec1 = Sec1_Opt.value().get();
+  REQUIRE(Sec1.GetNumEntries() == 2);
+  REQUIRE(Sec1["Key"].TryGetValue().value_or("bad") == "Value");
+  REQUIRE(Sec1["List"].GetValueCount() == 2);
+
+  // The last line has no trailing newline
+  IniSection &Sec2 = Sec2_Opt.value().get();
+  REQUIRE(Sec2["Other"].TryGetValue().value_or("bad") == "(1,2,3)");
+}
+
+TEST_CASE("Lines split across stream blocks are put back together", "[stream][parse]")
+{
+  const char *FileNames[] = {"EntryLists.ini", "EntryListWithMessyComments.ini", "MessyComments.ini", "SimpleWithSimpleComments.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    IniMappedFile Contents;
+    REQUIRE(Contents.Open(TestFileDirectory + FileName));
+
+    IniFile FromFile(TestFileDirectory + FileName);
+
+    for (std::size_t BlockSize : {std::size_t(1), std::size_t(7), std::size_t(64), IniScanner::DefaultBlockSize})
+    {
+      INFO(FileName << " with " << BlockSize << " byte blocks");
+
+      std::istringstream In{std::string(Contents.GetView())};
+
+      IniFile FromStream;
+      REQUIRE(FromStream.ParseStream(In, BlockSize));
+      RequireSameContents(FromFile, FromStream);
+    }
+  }
+}
+
+TEST_CASE("The regex parse mode also reads from a std::istream", "[stream][regex][parse]")
+{
+  IniMappedFile Contents;
+  REQUIRE(Contents.Open(TestFileDirectory + "EntryLists.ini"));
+
+  std::istringstream In{std::string(Contents.GetView())};
+
+  IniFile FromStream("", IniParseMode::Regex);
+  REQUIRE(FromStream.ParseStream(In));
+
+  IniFile FromFile(TestFileDirectory + "EntryLists.ini");
+  RequireSameContents(FromFile, FromStream);
+}
+
+TEST_CASE("A stream in a failed state is rejected", "[stream][parse]")
+{
+  std::istringstream In("[Section]\nKey=Value\n");
+  In.setstate(std::ios_base::failbit);
+
+  IniFile Ini;
+  REQUIRE_FALSE(Ini.ParseStream(In));
+  REQUIRE_FALSE(Ini.HasSection("Section"));
+}
+
+TEST_CASE("A stream that fails partway through is reported", "[stream][parse]")
+{
+  for (IniParseMode ParseMode : {IniParseMode::Scanner, IniParseMode::Regex})
+  {
+    FailingBuffer Buffer("[Section]\nKey=Value\n");
+    std::istream  In(&Buffer);
+
+    IniFile Ini("", ParseMode);
+    REQUIRE_FALSE(Ini.ParseStream(In));
+    REQUIRE(In.bad());
+  }
+}
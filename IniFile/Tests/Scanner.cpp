@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniScanner.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <sstream>
+
+namespace
+{
+  IniFile Parse(const std::string &Text, IniParseMode ParseMode)
+  {
+    IniFile            Ini("", ParseMode);
+    std::istringstream In(Text);
+    Ini.ParseStream(In);
+    return Ini;
+  }
+}  // namespace
+
+TEST_CASE("Single lines are classified by the scanner", "[scanner]")
+{
+  using Kind = IniScanner::LineKind;
+
+  SECTION("Blank lines, with or without CRLF endings and whitespace")
+  {
+    REQUIRE(IniScanner::ClassifyLine("").Kind == Kind::Blank);
+    REQUIRE(IniScanner::ClassifyLine("\r").Kind == Kind::Blank);
+    REQUIRE(IniScanner::ClassifyLine("  \t\r\n").Kind == Kind::Blank);
+  }
+
+  SECTION("Comment lines starting with '#' or ';'")
+  {
+    REQUIRE(IniScanner::ClassifyLine("# comment").Kind == Kind::Comment);
+    REQUIRE(IniScanner::ClassifyLine("; Key=Value").Kind == Kind::Comment);
+    REQUIRE(IniScanner::ClassifyLine("  #indented").Kind == Kind::Comment);
+  }
+
+  SECTION("Section headers, ignoring anything after the closing bracket")
+  {
+    auto Header = IniScanner::ClassifyLine("[Section2] ;Another comment\r");
+    REQUIRE(Header.Kind == Kind::Section);
+    REQUIRE(Header.Name == "Section2");
+
+    REQUIRE(IniScanner::ClassifyLine("[]").Kind == Kind::Unknown);
+    REQUIRE(IniScanner::ClassifyLine("[Unterminated").Kind == Kind::Unknown);
+  }
+
+  SECTION("Entries and appended list values")
+  {
+    auto Entry = IniScanner::ClassifyLine("Key2=Val2 #Comment with spaces\r");
+    REQUIRE(Entry.Kind == Kind::Entry);
+    REQUIRE(Entry.Name == "Key2");
+    REQUIRE(Entry.Value == "Val2");
+
+    auto Append = IniScanner::ClassifyLine(R"(+List=("Third",Value))");
+    REQUIRE(Append.Kind == Kind::Append);
+    REQUIRE(Append.Name == "List");
+    REQUIRE(Append.Value == R"(("Third",Value))");
+
+    auto Empty = IniScanner::ClassifyLine("Key=;nothing here");
+    REQUIRE(Empty.Kind == Kind::Entry);
+    REQUIRE(Empty.Value.empty());
+
+    REQUIRE(IniScanner::ClassifyLine("Key Value").Kind == Kind::Unknown);
+    REQUIRE(IniScanner::ClassifyLine("=Value").Kind == Kind::Unknown);
+    REQUIRE(IniScanner::ClassifyLine("+=Value").Kind == Kind::Unknown);
+  }
+}
+
+TEST_CASE("The scanner and regex parse modes produce the same contents for every test file", "[scanner][regex][parse]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile Scanned(TestFileDirectory + FileName, IniParseMode::Scanner);
+    IniFile Matched(TestFileDirectory + FileName, IniParseMode::Regex);
+
+    REQUIRE(Scanned.GetParseMode() == IniParseMode::Scanner);
+    REQUIRE(Matched.GetParseMode() == IniParseMode::Regex);
+
+    RequireSameContents(Matched, Scanned);
+  }
+}
+
+// The lines the two parse modes read differently, as documented on IniScanner
+TEST_CASE("Where the scanner and the regex parser differ", "[scanner][regex][parse]")
+{
+  SECTION("A whitespace only line ends a section for the scanner only")
+  {
+    const std::string Text = "[S]\nA=1\n  \t\nB=2\n";
+
+    IniFile Scanned = Parse(Text, IniParseMode::Scanner);
+    REQUIRE(Scanned.TryGetSection("S")->get().GetNumEntries() == 1);
+
+    IniFile Matched = Parse(Text, IniParseMode::Regex);
+    REQUIRE(Matched.TryGetSection("S")->get().GetNumEntries() == 2);
+    REQUIRE(Matched.TryGetSection("S")->get().HasEntry("B"));
+  }
+
+  SECTION("The regex parser finds a key anywhere in the line")
+  {
+    const std::string Text = "[S]\nmy-key=1\n; k=v\n";
+
+    IniFile Scanned = Parse(Text, IniParseMode::Scanner);
+    REQUIRE(Scanned.TryGetSection("S")->get().GetNumEntries() == 0);
+
+    IniFile     Matched = Parse(Text, IniParseMode::Regex);
+    IniSection &Section = Matched.TryGetSection("S")->get();
+    REQUIRE(Section.GetNumEntries() == 2);
+    REQUIRE(Section.TryGetEntry("key")->get().TryGetValue() == "1");
+    REQUIRE(Section.TryGetEntry("k")->get().TryGetValue() == "v");
+  }
+
+  SECTION("A section name ends at the first ']' for the scanner, the last for the regex parser")
+  {
+    const std::string Text = "[a]b]\nK=1\n";
+
+    REQUIRE(Parse(Text, IniParseMode::Scanner).HasSection("a"));
+    REQUIRE(Parse(Text, IniParseMode::Regex).HasSection("a]b"));
+  }
+
+  SECTION("The regex parser finds a header anywhere in the line")
+  {
+    const std::string Text = "x=[S]\nK=1\n";
+
+    IniFile Scanned = Parse(Text, IniParseMode::Scanner);
+    REQUIRE(Scanned.begin() == Scanned.end());
+
+    IniFile Matched = Parse(Text, IniParseMode::Regex);
+    REQUIRE(Matched.TryGetSection("S")->get().HasEntry("K"));
+  }
+}
@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniSharedSnapshot.h>
+#include <IniFile/IniWatcher.h>
+#include <IniFile/Tests/AllocationCounter.h>
+#include <IniFile/Tests/TestConfig.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  struct ExpectedEntry
+  {
+    std::string              Section;
+    std::string              Key;
+    std::vector<std::string> Values;
+  };
+
+  // Taken once, IniFile itself is not to be read from several threads
+  std::vector<ExpectedEntry> GetExpected(IniFile &File)
+  {
+    std::vector<ExpectedEntry> Expected;
+
+    for (auto &SectionPair : File)
+      for (auto &EntryPair : SectionPair.second)
+        Expected.push_back({std::string(SectionPair.first), std::string(EntryPair.first), std::vector<std::string>(EntryPair.second.GetValues().begin(), EntryPair.second.GetValues().end())});
+
+    return Expected;
+  }
+
+  std::size_t CountMismatches(const std::vector<ExpectedEntry> &Expected, const IniSharedSnapshot &Snapshot)
+  {
+    std::size_t Mismatches = 0;
+
+    for (const ExpectedEntry &Entry : Expected)
+    {
+      auto Found = Snapshot.TryGetEntry(Entry.Section, Entry.Key);
+      if (!Found || Found->GetValueCount() != Entry.Values.size())
+      {
+        ++Mismatches;
+        continue;
+      }
+
+      for (std::size_t v = 0; v < Entry.Values.size(); ++v)
+        Mismatches += (Found->GetValueView(v) != Entry.Values[v]);
+    }
+
+    return Mismatches;
+  }
+}  // namespace
+
+TEST_CASE("Shared snapshots find what the file holds", "[sharedsnapshot]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile                 File(TestFileDirectory + FileName);
+    const IniSharedSnapshot Snapshot(File);
+
+    REQUIRE(Snapshot.GetNumSections() == static_cast<std::size_t>(std::distance(File.begin(), File.end())));
+    REQUIRE(CountMismatches(GetExpected(File), Snapshot) == 0);
+  }
+}
+
+TEST_CASE("Shared snapshot copies share one FrozenIni", "[sharedsnapshot]")
+{
+  IniFile File;
+  File.ParseBuffer("[Server]\nPort=8080\n");
+
+  const IniSharedSnapshot Snapshot(File);
+  const IniSharedSnapshot Copy = Snapshot;
+  REQUIRE(Copy.IsSameAs(Snapshot));
+  REQUIRE(&Copy.GetFrozen() == &Snapshot.GetFrozen());
+  REQUIRE(Copy.TryGetEntry(IniKey("Server", "Port"))->GetInt() == 8080);
+
+  const IniSharedSnapshot Empty;
+  const IniSharedSnapshot FromNull{std::shared_ptr<const FrozenIni>()};
+  REQUIRE(Empty.GetNumSections() == 0);
+  REQUIRE_FALSE(Empty.HasSection("Server"));
+  REQUIRE(FromNull.IsSameAs(Empty));
+  REQUIRE_FALSE(Empty.IsSameAs(Snapshot));
+}
+
+TEST_CASE("Shared snapshot lookups write nothing", "[sharedsnapshot]")
+{
+  IniFile File;
+  File.ParseBuffer("[Server]\nPort=8080\nRatio=0.5\nEnabled=true\n");
+
+  const IniSharedSnapshot Snapshot(File);
+
+  std::size_t Allocations = 0;
+  bool        AllFound = true;
+  {
+    AllocationScope Scope;
+
+    for (int i = 0; i < 100; ++i)
+    {
+      AllFound &= Snapshot.TryGetEntry("Server", "Port")->GetInt() == 8080;
+      AllFound &= Snapshot.TryGetEntry(IniKey("Server", "Ratio"))->GetDouble() == 0.5;
+      AllFound &= Snapshot.TryGetSection("Server")->TryGetEntry("Enabled")->GetBool() == true;
+      AllFound &= !Snapshot.TryGetEntry("Server", "Missing");
+    }
+
+    Allocations = Scope.GetCount();
+  }
+
+  REQUIRE(AllFound);
+  REQUIRE(Allocations == 0);
+}
+
+TEST_CASE("Threads read one shared snapshot at once", "[sharedsnapshot]")
+{
+  IniFile                          File(TestFileDirectory + "EntryLists.ini");
+  const IniSharedSnapshot          Snapshot(File);
+  const std::vector<ExpectedEntry> Expected = GetExpected(File);
+
+  // Each thread takes its own copy up front, like a request handler would
+  std::atomic<std::size_t> Mismatches{0};
+  std::vector<std::thread> Threads;
+  for (int t = 0; t < 8; ++t)
+  {
+    Threads.emplace_back([&, Mine = Snapshot]() {
+      for (int i = 0; i < 200; ++i)
+        Mismatches += CountMismatches(Expected, Mine);
+    });
+  }
+
+  for (std::thread &Thread : Threads)
+    Thread.join();
+
+  REQUIRE(Mismatches == 0);
+}
+
+TEST_CASE("Watcher readers only take a snapshot after a reload", "[sharedsnapshot][watcher]")
+{
+  const std::string FileName = (std::filesystem::temp_directory_path() / "IniFileTest_SharedSnapshotReader.ini").string();
+  std::ofstream(FileName, std::ios_base::out | std::ios_base::trunc) << "[Server]\nPort=1\n";
+
+  IniWatcher         Watcher(FileName);
+  IniWatcher::Reader Reader(Watcher);
+
+  const IniSharedSnapshot First = Reader.Get();
+  REQUIRE(First.TryGetEntry("Server", "Port")->GetInt() == 1);
+  REQUIRE(Reader.Get().IsSameAs(First));
+
+  std::ofstream(FileName, std::ios_base::out | std::ios_base::trunc) << "[Server]\nPort=2\n";
+  REQUIRE(Watcher.Reload());
+
+  REQUIRE_FALSE(Reader.Get().IsSameAs(First));
+  REQUIRE(Reader.Get().TryGetEntry("Server", "Port")->GetInt() == 2);
+  REQUIRE(First.TryGetEntry("Server", "Port")->GetInt() == 1);
+
+  std::filesystem::remove(FileName);
+}
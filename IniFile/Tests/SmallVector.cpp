@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniSmallVector.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using StringVector = IniSmallVector<std::pmr::string, 2>;
+
+static std::vector<std::string> ToStrings(const StringVector &Values)
+{
+  return std::vector<std::string>(Values.begin(), Values.end());
+}
+
+TEST_CASE("IniSmallVector keeps its first elements inline", "[smallvector]")
+{
+  CountingResource Counting;
+  StringVector     Values(&Counting);
+
+  Values.emplace_back("One");
+  Values.emplace_back("Two");
+
+  REQUIRE(Values.is_inline());
+  REQUIRE(Values.size() == 2);
+  REQUIRE(Counting.GetAllocationCount() == 0);
+
+  SECTION("Growing past the inline capacity moves everything to the resource")
+  {
+    Values.emplace_back("Three");
+
+    REQUIRE_FALSE(Values.is_inline());
+    REQUIRE(Values.capacity() >= 3);
+    REQUIRE(Counting.GetAllocationCount() == 1);
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"One", "Two", "Three"});
+  }
+
+  SECTION("Elements are constructed with the container's resource")
+  {
+    Values.emplace_back("A value much too long for the small string buffer");
+
+    REQUIRE(Values.back().get_allocator().resource() == &Counting);
+    REQUIRE(Counting.GetLiveAllocations() == 2);
+  }
+
+  SECTION("Clearing a container hands its buffer back")
+  {
+    Values.emplace_back("Three");
+    {
+      StringVector Moved(std::move(Values));
+      REQUIRE(Moved.size() == 3);
+    }
+
+    REQUIRE(Counting.GetLiveAllocations() == 0);
+  }
+}
+
+TEST_CASE("IniSmallVector supports insertion and removal anywhere", "[smallvector]")
+{
+  StringVector Values;
+
+  SECTION("Inline")
+  {
+    Values.emplace_back("B");
+    Values.emplace_front("A");
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"A", "B"});
+
+    Values.erase(Values.cbegin());
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"B"});
+  }
+
+  SECTION("Spilled")
+  {
+    for (const char *Value : {"B", "C", "D", "E"})
+      Values.emplace_back(Value);
+
+    Values.emplace_front("A");
+    Values.emplace(Values.cbegin() + 3, "CD");
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"A", "B", "C", "CD", "D", "E"});
+
+    Values.erase(Values.cbegin() + 1, Values.cbegin() + 3);
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"A", "CD", "D", "E"});
+
+    Values.erase(Values.cend() - 1);
+    REQUIRE(ToStrings(Values) == std::vector<std::string>{"A", "CD", "D"});
+  }
+
+  SECTION("Appending an element of the container itself while it grows")
+  {
+    Values.emplace_back("Repeated value that does not fit in a small string");
+    Values.emplace_back("Second");
+    Values.emplace_back(Values.front());
+
+    REQUIRE(Values.size() == 3);
+    REQUIRE(Values[2] == Values[0]);
+  }
+
+  std::vector<std::string> Reversed = ToStrings(Values);
+  std::reverse(Reversed.begin(), Reversed.end());
+  REQUIRE(std::vector<std::string>(Values.rbegin(), Values.rend()) == Reversed);
+}
+
+TEST_CASE("IniSmallVector copies and moves between resources", "[smallvector][pmr]")
+{
+  CountingResource First;
+  CountingResource Second;
+
+  for (std::size_t NumValues : {1, 2, 5})
+  {
+    INFO(NumValues);
+
+    StringVector Values(&First);
+    for (std::size_t i = 0; i < NumValues; ++i)
+      Values.emplace_back("Value" + std::to_string(i));
+
+    const StringVector Copy(Values, &Second);
+    REQUIRE(Copy == Values);
+    REQUIRE(Copy.get_allocator().resource() == &Second);
+    REQUIRE(Copy.front().get_allocator().resource() == &Second);
+
+    StringVector Moved(std::move(Values), &Second);
+    REQUIRE(Moved == Copy);
+    REQUIRE(Values.empty());
+
+    StringVector Assigned(&First);
+    Assigned = Moved;
+    REQUIRE(Assigned == Copy);
+    REQUIRE(Assigned.get_allocator().resource() == &First);
+
+    StringVector Other(&First);
+    Other.emplace_back("Other");
+    Other.swap(Assigned);
+    REQUIRE(Other == Copy);
+    REQUIRE(ToStrings(Assigned) == std::vector<std::string>{"Other"});
+  }
+
+  REQUIRE(First.GetLiveAllocations() == 0);
+  REQUIRE(Second.GetLiveAllocations() == 0);
+}
+
+TEST_CASE("Single valued entries do not allocate for their value list", "[smallvector][entry]")
+{
+  CountingResource Counting;
+  IniEntry         Entry(std::string_view("Key"), &Counting);
+
+  Entry.AddValue("Value1");
+  Entry.AddValue("Value2");
+  REQUIRE(Counting.GetAllocationCount() == 0);
+
+  Entry.AddValue("Value3");
+  REQUIRE(Entry.GetValueCount() == 3);
+  REQUIRE(std::get<0>(Entry.RemoveValue(1)));
+  REQUIRE(Entry[0].value_or("bad") == "Value1");
+  REQUIRE(Entry[1].value_or("bad") == "Value3");
+  REQUIRE_FALSE(Entry[2].has_value());
+}
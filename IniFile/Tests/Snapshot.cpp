@@ -0,0 +1,271 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/FrozenIni.h>
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+  // Lookup code written once against IniFile's API
+  template<class Backend>
+  std::optional<std::int64_t> ReadPort(Backend &File)
+  {
+    auto Section_Opt = File.TryGetSection("Server");
+    if (!Section_Opt)
+      return std::nullopt;
+
+    auto Entry_Opt = Section_Opt->get().TryGetEntry("Port");
+    if (!Entry_Opt)
+      return std::nullopt;
+
+    return Entry_Opt->get().GetInt();
+  }
+
+  template<class Backend>
+  std::string ReadHosts(Backend &File)
+  {
+    std::string Hosts;
+
+    auto Entry_Opt = File.TryGetSection("Server")->get().TryGetEntry("Host");
+    for (std::size_t v = 0; v < Entry_Opt->get().GetValueCount(); ++v)
+      Hosts += Entry_Opt->get()[v].value_or("bad") + ",";
+
+    return Hosts;
+  }
+}  // namespace
+
+TEST_CASE("A snapshot reads back the same contents", "[snapshot][frozen]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  const std::string SnapshotFileName = TempFilePath("IniFileTest_Snapshot.bin");
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile Ini(TestFileDirectory + FileName);
+    REQUIRE(Ini.Freeze().WriteSnapshot(SnapshotFileName));
+
+    FrozenIni Snapshot;
+    REQUIRE(Snapshot.OpenSnapshot(SnapshotFileName));
+    REQUIRE(Snapshot.IsMapped());
+    REQUIRE(Snapshot.GetNumSections() == static_cast<std::size_t>(std::distance(Ini.begin(), Ini.end())));
+
+    for (auto &SectionPair : Ini)
+    {
+      auto Section_Opt = Snapshot.TryGetSection(SectionPair.first);
+      REQUIRE(Section_Opt.has_value());
+      REQUIRE(Section_Opt->GetNumEntries() == SectionPair.second.GetNumEntries());
+
+      for (auto &EntryPair : SectionPair.second)
+      {
+        auto Entry_Opt = Section_Opt->TryGetEntry(EntryPair.first);
+        REQUIRE(Entry_Opt.has_value());
+        REQUIRE(Entry_Opt->GetValueCount() == EntryPair.second.GetValueCount());
+
+        for (std::size_t v = 0; v < EntryPair.second.GetValueCount(); ++v)
+          REQUIRE((*Entry_Opt)[v] == EntryPair.second[v]);
+      }
+    }
+  }
+
+  std::filesystem::remove(SnapshotFileName);
+}
+
+TEST_CASE("Snapshots answer the same lookups as IniFile", "[snapshot][frozen]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\n"
+                  "Host=alpha\n"
+                  "Port=8080\n"
+                  "+Host=beta\n");
+
+  const std::string SnapshotFileName = TempFilePath("IniFileTest_SnapshotLookups.bin");
+  REQUIRE(Ini.Freeze().WriteSnapshot(SnapshotFileName));
+
+  FrozenIni Snapshot;
+  REQUIRE(Snapshot.OpenSnapshot(SnapshotFileName));
+
+  REQUIRE(ReadPort(Ini) == 8080);
+  REQUIRE(ReadPort(Snapshot) == 8080);
+  REQUIRE(ReadHosts(Ini) == "alpha,beta,");
+  REQUIRE(ReadHosts(Snapshot) == "alpha,beta,");
+
+  SECTION("Opening and reading a snapshot does not allocate")
+  {
+    FrozenIni   Reopened;
+    std::size_t Allocations = 0;
+    {
+      AllocationScope Scope;
+      REQUIRE(Reopened.OpenSnapshot(SnapshotFileName));
+      REQUIRE(Reopened.TryGetEntry("Server", "Port")->GetInt() == 8080);
+      REQUIRE(Reopened.TryGetEntry(IniKey("Server", "Host"))->GetValueView(1) == "beta");
+      Allocations = Scope.GetCount();
+    }
+
+    REQUIRE(Allocations == 0);
+  }
+
+  SECTION("A snapshot stays readable after being moved")
+  {
+    FrozenIni Moved(std::move(Snapshot));
+    REQUIRE(ReadPort(Moved) == 8080);
+    REQUIRE(Snapshot.GetNumSections() == 0);
+  }
+
+  std::filesystem::remove(SnapshotFileName);
+}
+
+TEST_CASE("Files that are not snapshots are refused", "[snapshot][frozen]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\nPort=8080\n");
+
+  const std::string SnapshotFileName = TempFilePath("IniFileTest_BadSnapshot.bin");
+  REQUIRE(Ini.Freeze().WriteSnapshot(SnapshotFileName));
+
+  FrozenIni Snapshot;
+
+  SECTION("A truncated snapshot")
+  {
+    std::filesystem::resize_file(SnapshotFileName, std::filesystem::file_size(SnapshotFileName) - 8);
+    REQUIRE_FALSE(Snapshot.OpenSnapshot(SnapshotFileName));
+  }
+
+  SECTION("A text file")
+  {
+    std::ofstream(SnapshotFileName, std::ios_base::binary | std::ios_base::trunc) << "[Server]\nPort=8080\n";
+    REQUIRE_FALSE(Snapshot.OpenSnapshot(SnapshotFileName));
+  }
+
+  SECTION("A missing file")
+  {
+    REQUIRE_FALSE(Snapshot.OpenSnapshot(SnapshotFileName + ".missing"));
+  }
+
+  REQUIRE(Snapshot.GetNumSections() == 0);
+  REQUIRE_FALSE(Snapshot.HasSection("Server"));
+
+  std::filesystem::remove(SnapshotFileName);
+}
+
+TEST_CASE("Snapshots with damaged records are refused or read in bounds", "[snapshot][frozen]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\n"
+                  "Host=alpha\n"
+                  "+Host=beta\n"
+                  "Port=8080\n"
+                  "\n"
+                  "[Client]\n"
+                  "Retries=3\n");
+
+  const std::string SnapshotFileName = TempFilePath("IniFileTest_DamagedSnapshot.bin");
+  REQUIRE(Ini.Freeze().WriteSnapshot(SnapshotFileName));
+
+  const std::string Good = ReadFileContents(SnapshotFileName);
+
+  // Every word of the file in turn, header, records, hash tables and text,
+  // set to an offset or count far past the end of the file. A snapshot that
+  // still opens has to be walkable without reading outside the mapping.
+  std::size_t Refused = 0;
+  for (std::size_t Offset = 0; Offset + sizeof(std::uint32_t) <= Good.size(); Offset += sizeof(std::uint32_t))
+  {
+    for (std::uint32_t Bad : {0xFFFFFFFFu, 0x00100000u})
+    {
+      std::string Damaged = Good;
+      std::memcpy(&Damaged[Offset], &Bad, sizeof(Bad));
+      std::ofstream(SnapshotFileName, std::ios_base::binary | std::ios_base::trunc) << Damaged;
+
+      FrozenIni Snapshot;
+      if (!Snapshot.OpenSnapshot(SnapshotFileName))
+      {
+        ++Refused;
+        REQUIRE(Snapshot.GetNumSections() == 0);
+        continue;
+      }
+
+      std::size_t Length = 0;
+      for (std::size_t s = 0; s < Snapshot.GetNumSections(); ++s)
+      {
+        const FrozenIni::SectionView Section = Snapshot.GetSection(s);
+        Length += Section.GetName().size();
+
+        for (FrozenIni::EntryView Entry : Section)
+        {
+          Length += Entry.GetKey().size() + Entry.GetSectionName().size();
+          for (std::size_t v = 0; v < Entry.GetValueCount(); ++v)
+            Length += Entry.GetValueView(v)->size();
+        }
+      }
+
+      Snapshot.TryGetEntry("Server", "Port");
+      Snapshot.TryGetEntry("Client", "Retries");
+      REQUIRE(Length <= Snapshot.GetMemoryUsage());
+    }
+  }
+
+  REQUIRE(Refused > 0);
+
+  std::filesystem::remove(SnapshotFileName);
+}
+
+TEST_CASE("A snapshot that cannot be written leaves no temporary file", "[snapshot][frozen]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\nPort=8080\n");
+
+  // A directory that is not empty cannot be replaced by a file
+  const std::string DirectoryName = TempFilePath("IniFileTest_SnapshotDirectory");
+  std::filesystem::create_directories(DirectoryName + "/Child");
+
+  REQUIRE_FALSE(Ini.Freeze().WriteSnapshot(DirectoryName));
+  REQUIRE(CountTempFilesFor(DirectoryName) == 0);
+
+  std::filesystem::remove_all(DirectoryName);
+}
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniSubscriptions.h>
+#include <IniFile/IniWatcher.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+  const std::string Original = "[Server]\n"
+                               "Host=localhost\n"
+                               "Port=8080\n"
+                               "\n"
+                               "[Timeouts]\n"
+                               "RequestMs=250\n"
+                               "+RequestMs=500\n"
+                               "\n"
+                               "[Logging]\n"
+                               "Level=Info\n";
+
+  const std::string Changed = "[Server]\n"
+                              "Host=localhost\n"
+                              "Port=9090\n"
+                              "\n"
+                              "[Timeouts]\n"
+                              "RequestMs=250\n"
+                              "+RequestMs=500\n"
+                              "\n"
+                              "[Cache]\n"
+                              "SizeMb=128\n";
+
+  // Every call as "Section.Key"
+  struct Recorder
+  {
+    std::mutex               Mutex;
+    std::vector<std::string> Calls;
+
+    IniSubscriptions::EntryCallback OnEntry()
+    {
+      return [this](std::string_view SectionName, const IniDiff::EntryChange &Change) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Calls.push_back(std::string(SectionName) + "." + Change.Key);
+      };
+    }
+
+    IniSubscriptions::SectionCallback OnSection()
+    {
+      return [this](const IniDiff::SectionChange &Change) {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        Calls.push_back(Change.Name);
+      };
+    }
+
+    std::vector<std::string> Take()
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      return std::move(Calls);
+    }
+  };
+}  // namespace
+
+TEST_CASE("Only subscriptions on changed keys and sections are called", "[subscriptions]")
+{
+  Recorder         Record;
+  IniSubscriptions Subscriptions;
+
+  Subscriptions.Subscribe("Server", "Port", Record.OnEntry());
+  Subscriptions.Subscribe("Server", "Host", Record.OnEntry());
+  Subscriptions.Subscribe("Timeouts", "RequestMs", Record.OnEntry());
+  Subscriptions.Subscribe("Logging", "Level", Record.OnEntry());
+  Subscriptions.Subscribe("Cache", "SizeMb", Record.OnEntry());
+  Subscriptions.SubscribeSection("Server", Record.OnSection());
+  Subscriptions.SubscribeSection("Timeouts", Record.OnSection());
+  REQUIRE(Subscriptions.GetNumSubscriptions() == 7);
+
+  Subscriptions.Dispatch(IniDiff(Parse(Original), Parse(Changed)));
+
+  // Section callbacks first, then keys, added sections before removed ones
+  const std::vector<std::string> Expected = {"Server", "Server.Port", "Cache.SizeMb", "Logging.Level"};
+  REQUIRE(Record.Take() == Expected);
+
+  // Nothing changed, nothing is called
+  Subscriptions.Dispatch(IniDiff(Parse(Changed), Parse(Changed)));
+  REQUIRE(Record.Take().empty());
+}
+
+TEST_CASE("Entry callbacks get the values that changed", "[subscriptions]")
+{
+  IniSubscriptions Subscriptions;
+
+  std::vector<IniDiff::ValueChange> Values;
+  Subscriptions.Subscribe("Timeouts", "RequestMs", [&Values](std::string_view SectionName, const IniDiff::EntryChange &Change) {
+    REQUIRE(SectionName == "Timeouts");
+    REQUIRE(Change.Kind == IniDiff::Change::Modified);
+    Values = Change.Values;
+  });
+
+  Subscriptions.Dispatch(IniDiff(Parse("[Timeouts]\nRequestMs=250\n+RequestMs=500\n"), Parse("[Timeouts]\nRequestMs=250\n+RequestMs=750\n+RequestMs=1000\n")));
+
+  REQUIRE(Values.size() == 2);
+  REQUIRE(Values[0].Kind == IniDiff::Change::Modified);
+  REQUIRE(Values[0].Index == 1);
+  REQUIRE(Values[0].NewValue == "750");
+  REQUIRE(Values[1].Kind == IniDiff::Change::Added);
+  REQUIRE(Values[1].NewValue == "1000");
+}
+
+TEST_CASE("Unsubscribed callbacks are not called", "[subscriptions]")
+{
+  Recorder         Record;
+  IniSubscriptions Subscriptions;
+
+  const IniSubscriptions::Id Port = Subscriptions.Subscribe("Server", "Port", Record.OnEntry());
+  const IniSubscriptions::Id Server = Subscriptions.SubscribeSection("Server", Record.OnSection());
+  Subscriptions.Subscribe("Server", "Port", Record.OnEntry());
+
+  REQUIRE(Subscriptions.Unsubscribe(Port));
+  REQUIRE_FALSE(Subscriptions.Unsubscribe(Port));
+  REQUIRE(Subscriptions.Unsubscribe(Server));
+  REQUIRE(Subscriptions.GetNumSubscriptions() == 1);
+
+  Subscriptions.Dispatch(IniDiff(Parse(Original), Parse(Changed)));
+  REQUIRE(Record.Take() == std::vector<std::string>{"Server.Port"});
+
+  Subscriptions.Unsubscribe(Server + 1);
+  REQUIRE(Subscriptions.IsEmpty());
+
+  Subscriptions.Dispatch(IniDiff(Parse(Original), Parse(Changed)));
+  REQUIRE(Record.Take().empty());
+}
+
+TEST_CASE("Empty keys cannot be subscribed to", "[subscriptions]")
+{
+  Recorder         Record;
+  IniSubscriptions Subscriptions;
+
+  REQUIRE(Subscriptions.Subscribe("Server", "", Record.OnEntry()) == IniSubscriptions::None);
+  REQUIRE(Subscriptions.IsEmpty());
+  REQUIRE_FALSE(Subscriptions.Unsubscribe(IniSubscriptions::None));
+
+  // Nothing was left behind for a section subscription to collide with
+  const IniSubscriptions::Id Server = Subscriptions.SubscribeSection("Server", Record.OnSection());
+  REQUIRE(Server != IniSubscriptions::None);
+  REQUIRE(Subscriptions.Unsubscribe(Server));
+  REQUIRE(Subscriptions.IsEmpty());
+
+  Subscriptions.Dispatch(IniDiff(Parse(Original), Parse(Changed)));
+  REQUIRE(Record.Take().empty());
+}
+
+TEST_CASE("IniWatcher dispatches the changes of each reload", "[subscriptions][watcher]")
+{
+  const std::string Name = "IniFileTest_Subscriptions.ini";
+  const std::string FileName = TempFilePath(Name);
+
+  auto Replace = [&](const std::string &Contents) { std::filesystem::rename(WriteTempFile(Name + ".new", Contents), FileName); };
+
+  Replace(Original);
+
+  Recorder   Record;
+  IniWatcher Watcher(FileName);
+
+  std::string SeenPort;
+  Watcher.Subscribe("Server", "Port", [&Watcher, &SeenPort](std::string_view, const IniDiff::EntryChange &) {
+    // The snapshot is published before callbacks run
+    SeenPort = std::string(*Watcher.GetSnapshot()->TryGetEntry("Server", "Port")->GetValueView(0));
+  });
+  Watcher.Subscribe("Server", "Host", Record.OnEntry());
+  Watcher.SubscribeSection("Cache", Record.OnSection());
+  const IniSubscriptions::Id Level = Watcher.Subscribe("Logging", "Level", Record.OnEntry());
+
+  // Whether the watcher thread or Reload reads the change, it is dispatched
+  // once: Reload waits for a load in progress and then finds nothing changed
+  Replace(Changed);
+  REQUIRE(Watcher.Reload());
+  REQUIRE(SeenPort == "9090");
+  REQUIRE(Record.Take() == std::vector<std::string>{"Cache", "Logging.Level"});
+
+  REQUIRE(Watcher.Unsubscribe(Level));
+  Replace(Original);
+  REQUIRE(Watcher.Reload());
+  REQUIRE(SeenPort == "8080");
+  REQUIRE(Record.Take() == std::vector<std::string>{"Cache"});
+
+  std::filesystem::remove(FileName);
+}
@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/IniSyntaxTree.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <filesystem>
+
+namespace
+{
+  const std::string Original = "# Operator maintained, keep the comments\n"
+                               "[Server]  ; main listener\n"
+                               "  Host=localhost   # trailing comment\n"
+                               "Port=8080\n"
+                               "+Port=8081 ; second listener\n"
+                               "; end of server\n"
+                               "\n"
+                               "[Timeouts]\n"
+                               "RequestMs=250\n"
+                               "\n"
+                               "[Server]\n"
+                               "Ignored=1\n"
+                               "\n"
+                               "# the end";
+
+  // The text the tree writes must parse to the tree's own IniFile
+  void RequireConsistent(const IniSyntaxTree &Tree)
+  {
+    IniFile Expected(Tree.GetFile());
+    IniFile Written;
+    Written.ParseBuffer(Tree.GetText());
+
+    RequireSameContents(Expected, Written);
+    RequireSameContents(Written, Expected);
+  }
+}  // namespace
+
+TEST_CASE("Unedited trees write the text they read", "[syntaxtree]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniSyntaxTree Tree;
+    REQUIRE(Tree.ReadFile(TestFileDirectory + FileName));
+    REQUIRE(Tree.GetText() == ReadFileContents(TestFileDirectory + FileName));
+
+    IniFile Expected(TestFileDirectory + FileName);
+    IniFile Actual(Tree.GetFile());
+    RequireSameContents(Expected, Actual);
+    RequireSameContents(Actual, Expected);
+  }
+
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Original);
+  REQUIRE(Tree.GetText() == Original);
+}
+
+TEST_CASE("Syntax tree files are replaced only once written in full", "[syntaxtree]")
+{
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Original);
+  REQUIRE(Tree.SetValue("Server", "Host", "example.com"));
+
+  SECTION("The file keeps its permissions")
+  {
+    const std::string FileName = WriteTempFile("IniFileTest_SyntaxTreeWrite.ini", Original);
+    const auto        Owner = std::filesystem::perms::owner_read | std::filesystem::perms::owner_write;
+    std::filesystem::permissions(FileName, Owner, std::filesystem::perm_options::replace);
+
+    REQUIRE(Tree.WriteFile(FileName));
+    REQUIRE(ReadFileContents(FileName) == Tree.GetText());
+    REQUIRE((std::filesystem::status(FileName).permissions() & std::filesystem::perms::mask) == Owner);
+    REQUIRE(CountTempFilesFor(FileName) == 0);
+
+    std::filesystem::remove(FileName);
+  }
+
+  SECTION("A write that fails on the last flush is reported")
+  {
+    if (std::filesystem::exists("/dev/full"))
+      REQUIRE_FALSE(Tree.WriteFile("/dev/full"));
+  }
+}
+
+TEST_CASE("Syntax tree lookups see the parsed contents", "[syntaxtree]")
+{
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Original);
+
+  REQUIRE(Tree.GetFile().HasSection("Server"));
+  REQUIRE(Tree.TryGetSection("Timeouts").has_value());
+  REQUIRE_FALSE(Tree.TryGetSection("Missing").has_value());
+
+  REQUIRE(Tree.TryGetEntry("Server", "Host")->get().TryGetValue() == "localhost");
+  REQUIRE(Tree.TryGetEntry("Server", "Port")->get().GetValueCount() == 2);
+  REQUIRE(Tree.TryGetEntry(IniKey("Timeouts", "RequestMs"))->get().GetInt() == 250);
+
+  // The second [Server] block is ignored by the parser
+  REQUIRE_FALSE(Tree.TryGetEntry("Server", "Ignored").has_value());
+}
+
+TEST_CASE("Syntax tree edits keep everything around them", "[syntaxtree]")
+{
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer(Original);
+
+  SECTION("Setting a value rewrites only the value")
+  {
+    REQUIRE(Tree.SetValue("Server", "Host", "example.com"));
+    REQUIRE(Tree.SetValue("Server", "Port", "9090"));
+
+    REQUIRE(Tree.GetText() == "# Operator maintained, keep the comments\n"
+                              "[Server]  ; main listener\n"
+                              "  Host=example.com   # trailing comment\n"
+                              "Port=9090\n"
+                              "; end of server\n"
+                              "\n"
+                              "[Timeouts]\n"
+                              "RequestMs=250\n"
+                              "\n"
+                              "[Server]\n"
+                              "Ignored=1\n"
+                              "\n"
+                              "# the end");
+    REQUIRE(Tree.TryGetEntry("Server", "Port")->get().GetValueCount() == 1);
+    RequireConsistent(Tree);
+  }
+
+  SECTION("Added values go after the last value, new entries after the last entry")
+  {
+    REQUIRE(Tree.AddValue("Server", "Port", "8082"));
+    REQUIRE(Tree.AddValue("Server", "Threads", "4"));
+    REQUIRE(Tree.AddValue("Timeouts", "ConnectMs", "100"));
+
+    REQUIRE(Tree.GetText() == "# Operator maintained, keep the comments\n"
+                              "[Server]  ; main listener\n"
+                              "  Host=localhost   # trailing comment\n"
+                              "Port=8080\n"
+                              "+Port=8081 ; second listener\n"
+                              "+Port=8082\n"
+                              "Threads=4\n"
+                              "; end of server\n"
+                              "\n"
+                              "[Timeouts]\n"
+                              "RequestMs=250\n"
+                              "ConnectMs=100\n"
+                              "\n"
+                              "[Server]\n"
+                              "Ignored=1\n"
+                              "\n"
+                              "# the end");
+    RequireConsistent(Tree);
+  }
+
+  SECTION("New sections are added at the end, after a blank line")
+  {
+    REQUIRE(Tree.SetValue("Added", "Key", "Value"));
+    REQUIRE(Tree.AddSection("Empty"));
+    REQUIRE_FALSE(Tree.AddSection("Empty"));
+
+    REQUIRE(Tree.GetText() == Original + "\n\n[Added]\nKey=Value\n\n[Empty]\n");
+    RequireConsistent(Tree);
+  }
+
+  SECTION("Removed entries and sections take their lines with them")
+  {
+    REQUIRE(Tree.RemoveEntry("Server", "Port"));
+    REQUIRE_FALSE(Tree.RemoveEntry("Server", "Port"));
+    REQUIRE(Tree.RemoveSection("Timeouts"));
+    REQUIRE_FALSE(Tree.TryGetSection("Timeouts").has_value());
+
+    REQUIRE(Tree.GetText() == "# Operator maintained, keep the comments\n"
+                              "[Server]  ; main listener\n"
+                              "  Host=localhost   # trailing comment\n"
+                              "; end of server\n"
+                              "\n"
+                              "\n"
+                              "[Server]\n"
+                              "Ignored=1\n"
+                              "\n"
+                              "# the end");
+    RequireConsistent(Tree);
+
+    // The ignored block goes too, or it would be read in place of the first
+    REQUIRE(Tree.RemoveSection("Server"));
+    REQUIRE(Tree.GetText() == "# Operator maintained, keep the comments\n"
+                              "\n"
+                              "\n"
+                              "\n"
+                              "# the end");
+    RequireConsistent(Tree);
+
+    REQUIRE(Tree.AddValue("Server", "Port", "1"));
+    RequireConsistent(Tree);
+  }
+
+  SECTION("Values that would not read back are refused")
+  {
+    REQUIRE_FALSE(Tree.SetValue("Server", "Host", "a # b"));
+    REQUIRE_FALSE(Tree.AddValue("Server", "Bad Key", "1"));
+    REQUIRE_FALSE(Tree.AddValue("Bad]Section", "Key", "1"));
+    REQUIRE_FALSE(Tree.AddSection(""));
+
+    REQUIRE(Tree.GetText() == Original);
+    REQUIRE(Tree.TryGetEntry("Server", "Host")->get().TryGetValue() == "localhost");
+  }
+}
+
+TEST_CASE("Syntax tree edits use the file's line ends", "[syntaxtree]")
+{
+  IniSyntaxTree Tree;
+  Tree.ParseBuffer("[First]\r\nKey=1 ; one\r\n\r\n[Second]\r\nKey=2");
+
+  REQUIRE(Tree.SetValue("First", "Key", "10"));
+  REQUIRE(Tree.AddValue("Second", "Other", "3"));
+  REQUIRE(Tree.AddSection("Third"));
+
+  REQUIRE(Tree.GetText() == "[First]\r\nKey=10 ; one\r\n\r\n[Second]\r\nKey=2\r\nOther=3\r\n\r\n[Third]\r\n");
+  RequireConsistent(Tree);
+}
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+// Path of Name in the temporary directory, for files a test has written for it
+inline std::string TempFilePath(const std::string &Name)
+{
+  return (std::filesystem::temp_directory_path() / Name).string();
+}
+
+// Writes Contents to Name in the temporary directory and returns its path,
+// writing the same name again replaces the contents in place. Tests remove the
+// file when they are done with it.
+inline std::string WriteTempFile(const std::string &Name, const std::string &Contents)
+{
+  const std::string Path = TempFilePath(Name);
+
+  std::ofstream Out(Path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  Out.write(Contents.data(), static_cast<std::streamsize>(Contents.size()));
+  return Path;
+}
+
+// The whole contents of a file, byte for byte
+inline std::string ReadFileContents(const std::string &Path)
+{
+  std::ifstream In(Path, std::ios_base::in | std::ios_base::binary);
+  return std::string(std::istreambuf_iterator<char>(In), std::istreambuf_iterator<char>());
+}
+
+// An IniFile holding the parsed Text
+inline IniFile Parse(std::string_view Text)
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  return Ini;
+}
+
+// Temporary files IniReplaceFile left next to Path, "<name>.<...>.tmp"
+inline std::size_t CountTempFilesFor(const std::string &Path)
+{
+  const std::filesystem::path File(Path);
+  const std::string           Prefix = File.filename().string() + ".";
+
+  std::size_t Count = 0;
+  for (const auto &Item : std::filesystem::directory_iterator(File.parent_path()))
+  {
+    const std::string Name = Item.path().filename().string();
+    if (Name.size() > Prefix.size() + 4 && Name.compare(0, Prefix.size(), Prefix) == 0 && Name.compare(Name.size() - 4, 4, ".tmp") == 0)
+      ++Count;
+  }
+
+  return Count;
+}
+
+// Requires both files to hold the same sections, entries and values
+inline void RequireSameContents(IniFile &Expected, IniFile &Actual)
+{
+  std::size_t NumSections = 0;
+
+  for (auto &SectionPair : Expected)
+  {
+    ++NumSections;
+
+    auto Section_Opt = Actual.TryGetSection(SectionPair.first);
+    REQUIRE(Section_Opt.has_value());
+
+    IniSection &ExpectedSection = SectionPair.second;
+    IniSection &ActualSection = Section_Opt.value().get();
+    REQUIRE(ActualSection.GetName() == ExpectedSection.GetName());
+    REQUIRE(ActualSection.GetNumEntries() == ExpectedSection.GetNumEntries());
+
+    for (auto &EntryPair : ExpectedSection)
+    {
+      auto Entry_Opt = ActualSection.TryGetEntry(EntryPair.first);
+      REQUIRE(Entry_Opt.has_value());
+      REQUIRE(Entry_Opt.value().get().GetValues() == EntryPair.second.GetValues());
+    }
+  }
+
+  REQUIRE(std::distance(Actual.begin(), Actual.end()) == static_cast<std::ptrdiff_t>(NumSections));
+}
@@ -0,0 +1,228 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+static const char *const Text = "[Typed]\n"
+                                "Int=42\n"
+                                "Negative=-17\n"
+                                "Plus=+8\n"
+                                "Large=9223372036854775807\n"
+                                "TooLarge=9223372036854775808\n"
+                                "Double=2.5e3\n"
+                                "Unit=42ms\n"
+                                "Empty=\n"
+                                "Yes=Yes\n"
+                                "Off=off\n"
+                                "Zero=0\n"
+                                "Ports=8080\n"
+                                "+Ports=8081\n"
+                                "+Ports=8082\n"
+                                "Mixed=1\n"
+                                "+Mixed=two\n"
+                                "+Mixed=3\n";
+
+TEST_CASE("Integers are converted with from_chars", "[typed]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Typed").value().get();
+
+  REQUIRE(Section["Int"].GetInt() == 42);
+  REQUIRE(Section["Negative"].GetInt() == -17);
+  REQUIRE(Section["Plus"].GetInt() == 8);
+  REQUIRE(Section["Large"].GetInt() == std::numeric_limits<std::int64_t>::max());
+  REQUIRE(Section["Ports"].GetInt(2) == 8082);
+
+  REQUIRE_FALSE(Section["TooLarge"].GetInt().has_value());
+  REQUIRE_FALSE(Section["Unit"].GetInt().has_value());
+  REQUIRE_FALSE(Section["Double"].GetInt().has_value());
+  REQUIRE_FALSE(Section["Empty"].GetInt().has_value());
+  REQUIRE_FALSE(Section["Ports"].GetInt(3).has_value());
+
+  SECTION("Other integer types range check their values")
+  {
+    REQUIRE(Section["Int"].GetAs<std::uint8_t>() == 42);
+    REQUIRE_FALSE(Section["Negative"].GetAs<unsigned>().has_value());
+    REQUIRE_FALSE(Section["Large"].GetAs<int>().has_value());
+  }
+}
+
+TEST_CASE("Doubles and bools are converted", "[typed]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Typed").value().get();
+
+  REQUIRE(Section["Double"].GetDouble() == 2500.0);
+  REQUIRE(Section["Int"].GetDouble() == 42.0);
+  REQUIRE_FALSE(Section["Unit"].GetDouble().has_value());
+
+  REQUIRE(Section["Yes"].GetBool() == true);
+  REQUIRE(Section["Off"].GetBool() == false);
+  REQUIRE(Section["Zero"].GetBool() == false);
+  REQUIRE_FALSE(Section["Int"].GetBool().has_value());
+
+  SECTION("Surrounding whitespace is ignored")
+  {
+    IniEntry Entry(std::string_view("Padded"), {" 12 ", "\t1.5", " true "});
+    REQUIRE(Entry.GetInt() == 12);
+    REQUIRE(Entry.GetDouble(1) == 1.5);
+    REQUIRE(Entry.GetBool(2) == true);
+  }
+}
+
+TEST_CASE("Lists are converted value by value", "[typed]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Typed").value().get();
+
+  std::vector<int> Ports;
+  REQUIRE(Section["Ports"].GetList<int>(std::back_inserter(Ports)));
+  REQUIRE(Ports == std::vector<int>{8080, 8081, 8082});
+
+  std::vector<int> Mixed;
+  REQUIRE_FALSE(Section["Mixed"].GetList<int>(std::back_inserter(Mixed)));
+  REQUIRE(Mixed == std::vector<int>{1});
+}
+
+TEST_CASE("Typed reads do not allocate", "[typed][allocator]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Typed").value().get();
+
+  int         Ports[3] = {};
+  std::size_t Allocations = 0;
+  {
+    AllocationScope Scope;
+
+    Section["Int"].GetInt();
+    Section["Double"].GetDouble();
+    Section["Yes"].GetBool();
+    Section["Unit"].GetInt();
+    Section["Ports"].GetList<int>(Ports);
+
+    Allocations = Scope.GetCount();
+  }
+
+  REQUIRE(Allocations == 0);
+  REQUIRE(Ports[2] == 8082);
+}
+
+TEST_CASE("The last conversion is cached until the values change", "[typed][cache]")
+{
+  IniEntry Entry(std::string_view("RequestMs"), {"250", "500"});
+
+  REQUIRE(Entry.GetInt() == 250);
+  REQUIRE(Entry.GetInt() == 250);
+  REQUIRE(Entry.GetInt(1) == 500);
+  REQUIRE(Entry.GetDouble(1) == 500.0);
+  REQUIRE(Entry.GetInt(1) == 500);
+
+  SECTION("AddValue")
+  {
+    Entry.Clear();
+    REQUIRE_FALSE(Entry.GetInt().has_value());
+    Entry.AddValue("750");
+    REQUIRE(Entry.GetInt() == 750);
+  }
+
+  SECTION("RemoveValue")
+  {
+    REQUIRE(Entry.GetInt() == 250);
+    Entry.RemoveValue(0);
+    REQUIRE(Entry.GetInt() == 500);
+  }
+
+  SECTION("Clear")
+  {
+    REQUIRE(Entry.GetInt() == 250);
+    Entry.Clear();
+    REQUIRE_FALSE(Entry.GetInt().has_value());
+  }
+
+  SECTION("Writing through iterators")
+  {
+    REQUIRE(Entry.GetInt() == 250);
+    *Entry.begin() = "1000";
+    REQUIRE(Entry.GetInt() == 1000);
+  }
+
+  SECTION("Writing through an iterator taken before the read")
+  {
+    auto It = Entry.begin();
+    REQUIRE(Entry.GetInt() == 250);
+    *It = "7";
+    REQUIRE(Entry.GetInt() == 7);
+    REQUIRE(Entry.GetDouble() == 7.0);
+    *It = "8";
+    REQUIRE(Entry.GetDouble() == 8.0);
+
+    // Nothing can point into the values after Clear, so caching resumes
+    Entry.Clear();
+    Entry.AddValue("9");
+    REQUIRE(Entry.GetInt() == 9);
+    REQUIRE(Entry.GetInt() == 9);
+  }
+
+  SECTION("Assignment and Swap")
+  {
+    IniEntry Other(std::string_view("Other"), std::string_view("true"));
+    REQUIRE(Other.GetBool() == true);
+    REQUIRE(Entry.GetInt() == 250);
+
+    Entry.Swap(Other);
+    REQUIRE(Entry.GetBool() == true);
+    REQUIRE_FALSE(Entry.GetInt().has_value());
+    REQUIRE(Other.GetInt() == 250);
+
+    Entry = Other;
+    REQUIRE(Entry.GetInt() == 250);
+  }
+
+  SECTION("Failed conversions are not cached")
+  {
+    IniEntry Unit(std::string_view("Unit"), std::string_view("5ms"));
+    REQUIRE_FALSE(Unit.GetInt().has_value());
+    Unit.Clear();
+    Unit.AddValue("5");
+    REQUIRE(Unit.GetInt() == 5);
+  }
+}
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/AllocationCounter.h>
+
+#include <string_view>
+
+static const char *const Text = "[Section]\n"
+                                "Long=AValueThatIsMuchTooLongForTheSmallStringBuffer\n"
+                                "+Long=AnotherValueThatIsMuchTooLongForTheSmallStringBuffer\n"
+                                "Empty=\n";
+
+TEST_CASE("Value views match the copying accessors", "[values]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  IniSection &Section = Ini.TryGetSection("Section").value().get();
+  IniEntry &  Long = Section["Long"];
+
+  REQUIRE(Long.TryGetValueView() == Long.TryGetValue().value());
+  REQUIRE(Long.GetValueView(0) == Long[0].value());
+  REQUIRE(Long.GetValueView(1) == Long[1].value());
+  REQUIRE_FALSE(Long.GetValueView(2).has_value());
+
+  REQUIRE(Section["Empty"].TryGetValueView() == std::string_view());
+  REQUIRE_FALSE(Section["Missing"].TryGetValueView().has_value());
+
+  // Views point into the entry's own storage
+  REQUIRE(Long.GetValueView(1)->data() == Long.GetValues()[1].data());
+}
+
+TEST_CASE("Reading values through views does not allocate", "[values][allocator]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer(Text);
+  const IniEntry &Long = Ini.TryGetSection("Section")->get()["Long"];
+
+  std::size_t ViewAllocations = 0;
+  std::size_t CopyAllocations = 0;
+  std::size_t TotalSize = 0;
+  {
+    AllocationScope Scope;
+    TotalSize += Long.TryGetValueView()->size();
+    TotalSize += Long.GetValueView(1)->size();
+    TotalSize += Long.GetValueView(2).value_or(std::string_view()).size();
+    ViewAllocations = Scope.GetCount();
+  }
+  {
+    AllocationScope Scope;
+    TotalSize += Long.TryGetValue()->size();
+    TotalSize += Long[1]->size();
+    CopyAllocations = Scope.GetCount();
+  }
+
+  REQUIRE(TotalSize == 2 * (Long.GetValues()[0].size() + Long.GetValues()[1].size()));
+  REQUIRE(ViewAllocations == 0);
+  REQUIRE(CopyAllocations == 2);
+}
@@ -0,0 +1,301 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniWatcher.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr int NumKeys = 16;
+
+  // Every key of every section holds the generation, so a reader can tell a
+  // snapshot that mixes two versions of the file
+  std::string MakeGeneration(int Generation, int NumSections = 8)
+  {
+    std::string Text = "[Meta]\nGeneration=" + std::to_string(Generation) + "\n\n";
+
+    for (int s = 0; s < NumSections; ++s)
+    {
+      Text += "[Section" + std::to_string(s) + "]\n";
+      for (int k = 0; k < NumKeys; ++k)
+        Text += "Key" + std::to_string(k) + "=" + std::to_string(Generation) + "\n";
+      Text += "\n";
+    }
+
+    return Text;
+  }
+
+  // Written next to the file and renamed over it, the way editors and
+  // deployment tools replace a file
+  void WriteReplace(const std::string &Name, const std::string &Contents)
+  {
+    std::filesystem::rename(WriteTempFile(Name + ".new", Contents), TempFilePath(Name));
+  }
+
+  // -1 for a snapshot of a file read while it was being rewritten in place
+  std::int64_t GenerationOf(const FrozenIni &Snapshot)
+  {
+    const auto Entry = Snapshot.TryGetEntry("Meta", "Generation");
+    return Entry ? Entry->GetInt().value_or(-1) : -1;
+  }
+
+  bool WaitForGeneration(const IniWatcher &Watcher, std::int64_t Generation)
+  {
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < Deadline)
+    {
+      if (GenerationOf(*Watcher.GetSnapshot()) == Generation)
+        return true;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return false;
+  }
+}  // namespace
+
+TEST_CASE("Watchers read the file up front", "[watcher]")
+{
+  const std::string Name = "IniFileTest_WatcherInitial.ini";
+  const std::string FileName = WriteTempFile(Name, MakeGeneration(1));
+
+  {
+    IniWatcher Watcher(FileName);
+    REQUIRE(Watcher.GetGeneration() == 1);
+    REQUIRE(GenerationOf(*Watcher.GetSnapshot()) == 1);
+
+    WriteTempFile(Name, MakeGeneration(2));
+    REQUIRE(Watcher.Reload());
+    REQUIRE(Watcher.GetGeneration() >= 2);
+    REQUIRE(GenerationOf(*Watcher.GetSnapshot()) == 2);
+  }
+
+  std::filesystem::remove(FileName);
+  REQUIRE_THROWS_AS(IniWatcher(FileName), std::runtime_error);
+}
+
+TEST_CASE("Watchers pick up changed files", "[watcher]")
+{
+  const std::string Name = "IniFileTest_WatcherChanges.ini";
+  const std::string FileName = WriteTempFile(Name, MakeGeneration(1));
+
+  IniWatcher Watcher(FileName, std::chrono::milliseconds(10));
+  const std::shared_ptr<const FrozenIni> First = Watcher.GetSnapshot();
+
+  WriteTempFile(Name, MakeGeneration(2));
+  REQUIRE(WaitForGeneration(Watcher, 2));
+
+  WriteReplace(Name, MakeGeneration(3));
+  REQUIRE(WaitForGeneration(Watcher, 3));
+
+  // A snapshot still held is left as it was
+  REQUIRE(GenerationOf(*First) == 1);
+
+  // A file that is gone keeps the last snapshot
+  std::filesystem::remove(FileName);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  REQUIRE(GenerationOf(*Watcher.GetSnapshot()) == 3);
+}
+
+TEST_CASE("Watchers follow a file name that is a symbolic link", "[watcher]")
+{
+  const std::string           Name = "IniFileTest_WatcherLinks";
+  const std::filesystem::path Directory = TempFilePath(Name);
+  std::filesystem::remove_all(Directory);
+  std::filesystem::create_directories(Directory / "v1");
+  std::filesystem::create_directories(Directory / "v2");
+
+  const std::string FileName = (Directory / "app.ini").string();
+
+  SECTION("The target is rewritten in place")
+  {
+    WriteTempFile(Name + "/v1/app.ini", MakeGeneration(1));
+    std::filesystem::create_symlink("v1/app.ini", FileName);
+
+    IniWatcher Watcher(FileName, std::chrono::milliseconds(10));
+    REQUIRE(GenerationOf(*Watcher.GetSnapshot()) == 1);
+
+    WriteTempFile(Name + "/v1/app.ini", MakeGeneration(2));
+    REQUIRE(WaitForGeneration(Watcher, 2));
+  }
+
+  // The way a Kubernetes ConfigMap volume is updated: the file is a link
+  // through "..data", and a new "..data" link is renamed over the old one
+  SECTION("A link on the way to the target is replaced")
+  {
+    WriteTempFile(Name + "/v1/app.ini", MakeGeneration(1));
+    WriteTempFile(Name + "/v2/app.ini", MakeGeneration(2));
+    std::filesystem::create_directory_symlink("v1", Directory / "..data");
+    std::filesystem::create_symlink("..data/app.ini", FileName);
+
+    IniWatcher Watcher(FileName, std::chrono::milliseconds(10));
+    REQUIRE(GenerationOf(*Watcher.GetSnapshot()) == 1);
+
+    std::filesystem::create_directory_symlink("v2", Directory / "..data_tmp");
+    std::filesystem::rename(Directory / "..data_tmp", Directory / "..data");
+    REQUIRE(WaitForGeneration(Watcher, 2));
+
+    // The new target directory is watched once the link moved to it
+    WriteTempFile(Name + "/v2/app.ini", MakeGeneration(3));
+    REQUIRE(WaitForGeneration(Watcher, 3));
+  }
+
+  std::filesystem::remove_all(Directory);
+}
+
+TEST_CASE("Readers never see a partial reload", "[watcher][stress]")
+{
+  const std::string Name = "IniFileTest_WatcherStress.ini";
+  const std::string FileName = WriteTempFile(Name, MakeGeneration(0));
+
+  constexpr int LastGeneration = 200;
+
+  IniWatcher Watcher(FileName, std::chrono::milliseconds(1));
+
+  std::atomic<bool>        Done{false};
+  std::atomic<int>         Torn{0};
+  std::atomic<int>         WentBack{0};
+  std::atomic<std::size_t> Lookups{0};
+
+  std::vector<std::thread> Readers;
+  for (int r = 0; r < 4; ++r)
+  {
+    Readers.emplace_back([&]() {
+      std::int64_t Newest = 0;
+      std::size_t  Count = 0;
+
+      while (!Done.load())
+      {
+        const std::shared_ptr<const FrozenIni> Snapshot = Watcher.GetSnapshot();
+        const std::int64_t                     Generation = GenerationOf(*Snapshot);
+
+        for (int s = 0; s < 8; ++s)
+        {
+          const std::string Section = "Section" + std::to_string(s);
+          for (int k = 0; k < NumKeys; ++k, ++Count)
+          {
+            auto Entry = Snapshot->TryGetEntry(Section, "Key" + std::to_string(k));
+            if (!Entry || Entry->GetInt() != Generation)
+              ++Torn;
+          }
+        }
+
+        if (Generation < Newest)
+          ++WentBack;
+        Newest = Generation;
+      }
+
+      Lookups += Count;
+    });
+  }
+
+  std::thread Writer([&]() {
+    for (int Generation = 1; Generation <= LastGeneration; ++Generation)
+    {
+      WriteReplace(Name, MakeGeneration(Generation));
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  });
+
+  Writer.join();
+  const bool Caught = WaitForGeneration(Watcher, LastGeneration);
+
+  Done = true;
+  for (std::thread &Reader : Readers)
+    Reader.join();
+
+  REQUIRE(Caught);
+  REQUIRE(Torn == 0);
+  REQUIRE(WentBack == 0);
+  REQUIRE(Lookups > 0);
+  REQUIRE(Watcher.GetGeneration() > 1);
+
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("Rewriting the file in place under load is survived", "[watcher][stress]")
+{
+  const std::string Name = "IniFileTest_WatcherInPlace.ini";
+  const std::string FileName = TempFilePath(Name);
+
+  // Large enough that a reload is often still reading when the next rewrite
+  // truncates the file
+  constexpr int NumSections = 256;
+  constexpr int LastGeneration = 200;
+  WriteTempFile(Name, MakeGeneration(0, NumSections));
+
+  IniWatcher Watcher(FileName, std::chrono::milliseconds(1));
+
+  std::atomic<bool>        Done{false};
+  std::atomic<std::size_t> Lookups{0};
+
+  // A reload can publish a half written file, readers only check that every
+  // snapshot they get can be read
+  std::vector<std::thread> Readers;
+  for (int r = 0; r < 2; ++r)
+  {
+    Readers.emplace_back([&]() {
+      std::size_t Count = 0;
+
+      while (!Done.load())
+      {
+        const std::shared_ptr<const FrozenIni> Snapshot = Watcher.GetSnapshot();
+        for (std::size_t s = 0; s < Snapshot->GetNumSections(); ++s)
+          for (FrozenIni::EntryView Entry : Snapshot->GetSection(s))
+            Count += Entry.GetValueCount();
+      }
+
+      Lookups += Count;
+    });
+  }
+
+  for (int Generation = 1; Generation <= LastGeneration; ++Generation)
+    WriteTempFile(Name, MakeGeneration(Generation, NumSections));
+
+  // The close after the last rewrite reloads the complete file
+  const bool Caught = WaitForGeneration(Watcher, LastGeneration);
+
+  Done = true;
+  for (std::thread &Reader : Readers)
+    Reader.join();
+
+  REQUIRE(Caught);
+  REQUIRE(Lookups > 0);
+
+  std::filesystem::remove(FileName);
+}
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////
+//
+// MIT License
+//
+// Copyright(c) 2018 Kurt Slagle - kurt_slagle@yahoo.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// The origin of this software must not be misrepresented; you must not claim
+// that you wrote the original software.If you use this software in a product,
+// an acknowledgment of the software used is required.
+//
+////////////////////////////////////////////////////////////
+
+#include <IniFile/catch.hpp>
+
+#include <IniFile/IniFile.h>
+#include <IniFile/Tests/TestConfig.h>
+#include <IniFile/Tests/TestUtils.h>
+
+#include <filesystem>
+#include <sstream>
+
+namespace
+{
+  IniFile ReadBack(const IniFile &Written)
+  {
+    std::ostringstream Out;
+    REQUIRE(Written.WriteTo(Out));
+
+    IniFile Read;
+    Read.ParseBuffer(Out.str());
+    return Read;
+  }
+}  // namespace
+
+TEST_CASE("Written files read back the same", "[writer]")
+{
+  const char *FileNames[] = {
+    "Simple.ini",
+    "SimpleMultipleSections.ini",
+    "SimpleWithSimpleComments.ini",
+    "EntryLists.ini",
+    "EntryListWithMessyComments.ini",
+    "MessyComments.ini",
+    "MultipleSectionBlocks.ini"};
+
+  for (const char *FileName : FileNames)
+  {
+    INFO(FileName);
+
+    IniFile Original(TestFileDirectory + FileName);
+    IniFile Written = ReadBack(Original);
+
+    RequireSameContents(Original, Written);
+    RequireSameContents(Written, Original);
+  }
+}
+
+TEST_CASE("Modified files are written with their changes", "[writer]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\n"
+                  "Host=localhost\n"
+                  "+Host=backup\n"
+                  "Port=8080\n");
+
+  IniSection &Server = Ini.TryGetSection("Server").value().get();
+  Server["Port"].Clear();
+  Server["Port"].AddValue("9090");
+  Server["Host"].AddValue("third");
+  Server["Threads"].AddValue(" 4");
+
+  Ini.ParseBuffer("[Added]\nKey=(List, \"Value\")\n");
+
+  std::ostringstream Out;
+  REQUIRE(Ini.WriteTo(Out));
+  REQUIRE(Out.str() == "[Server]\n"
+                       "Host=localhost\n"
+                       "+Host=backup\n"
+                       "+Host=third\n"
+                       "Port=9090\n"
+                       "Threads= 4\n"
+                       "\n"
+                       "[Added]\n"
+                       "Key=(List, \"Value\")\n"
+                       "\n");
+
+  IniFile Written = ReadBack(Ini);
+  RequireSameContents(Ini, Written);
+
+  SECTION("Writing to a file")
+  {
+    const std::string FileName = (std::filesystem::temp_directory_path() / "IniFileTest_Writer.ini").string();
+    REQUIRE(Ini.WriteFile(FileName));
+
+    IniFile FromFile(FileName);
+    RequireSameContents(Ini, FromFile);
+    std::filesystem::remove(FileName);
+  }
+}
+
+TEST_CASE("WriteFile replaces the file only once it is written in full", "[writer]")
+{
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\nPort=8080\n");
+
+  const std::string FileName = WriteTempFile("IniFileTest_WriterReplace.ini", "[Old]\nKey=Value\n");
+
+  SECTION("The file keeps its permissions")
+  {
+    const auto Owner = std::filesystem::perms::owner_read | std::filesystem::perms::owner_write;
+    std::filesystem::permissions(FileName, Owner, std::filesystem::perm_options::replace);
+
+    REQUIRE(Ini.WriteFile(FileName));
+    REQUIRE((std::filesystem::status(FileName).permissions() & std::filesystem::perms::mask) == Owner);
+
+    IniFile FromFile(FileName);
+    RequireSameContents(Ini, FromFile);
+  }
+
+  SECTION("A write that fails on the last flush is reported")
+  {
+    if (std::filesystem::exists("/dev/full"))
+      REQUIRE_FALSE(Ini.WriteFile("/dev/full"));
+  }
+
+  SECTION("A file in a missing directory is not written")
+  {
+    REQUIRE_FALSE(Ini.WriteFile(TempFilePath("IniFileTest_NoSuchDirectory") + "/Writer.ini"));
+  }
+
+  REQUIRE(CountTempFilesFor(FileName) == 0);
+  std::filesystem::remove(FileName);
+}
+
+TEST_CASE("Contents the grammar cannot hold are not written", "[writer]")
+{
+  auto RequireNotWritten = [](IniFile &Ini) {
+    std::ostringstream Out;
+    REQUIRE_FALSE(Ini.WriteTo(Out));
+    REQUIRE(Out.str().empty());
+  };
+
+  IniFile Ini;
+  Ini.ParseBuffer("[Server]\nHost=localhost\n");
+  IniSection &Server = Ini.TryGetSection("Server").value().get();
+
+  SECTION("Comment characters in values")
+  {
+    Server["Host"].AddValue("a#b");
+    RequireNotWritten(Ini);
+  }
+
+  SECTION("Line ends in values")
+  {
+    Server["Host"].AddValue("a\nb");
+    RequireNotWritten(Ini);
+  }
+
+  SECTION("Trailing whitespace in values")
+  {
+    Server["Host"].AddValue("value ");
+    RequireNotWritten(Ini);
+  }
+
+  SECTION("Keys that are not words")
+  {
+    Server["Two words"].AddValue("value");
+    RequireNotWritten(Ini);
+  }
+
+  SECTION("Entries without values are left out")
+  {
+    Server["Empty"];
+
+    std::ostringstream Out;
+    REQUIRE(Ini.WriteTo(Out));
+    REQUIRE(Out.str() == "[Server]\nHost=localhost\n\n");
+  }
+}